@@ -4,12 +4,13 @@ namespace Dynamo {
     Application::Application(const ApplicationSettings &settings) {
         _display = std::make_unique<Display>(settings.title, settings.window_width, settings.window_height);
         _renderer = std::make_unique<Graphics::Vulkan::Renderer>(*_display, settings.root_asset_directory);
-        _jukebox = std::make_unique<Sound::Jukebox>();
+        _jukebox = std::make_unique<Sound::Jukebox>(settings.audio_threads);
 
-        // Run audio on a separate thread
+        // Run audio on a separate thread, sleeping until the device needs more samples
         _audio_thread = std::thread([&]() {
             while (is_running()) {
                 _jukebox->update();
+                _jukebox->wait();
             }
         });
     }
@@ -37,6 +37,13 @@ namespace Dynamo {
          *
          */
         std::string root_asset_directory;
+
+        /**
+         * @brief Number of worker threads for mixing audio sources in
+         * parallel, or 0 to mix on the audio thread.
+         *
+         */
+        unsigned audio_threads = 0;
     };
 
     /**
@@ -1,9 +1,80 @@
 #include <Asset/Sound.hpp>
+#include <Math/Vectorize.hpp>
 #include <Sound/DSP/Resample.hpp>
 #include <Utils/Log.hpp>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <filesystem>
+#include <optional>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <thread>
+#include <unistd.h>
 
 namespace Dynamo {
-    Sound::Buffer load_sound(const std::string filepath) {
+    /**
+     * @brief Decodes a sound file with libsndfile.
+     *
+     */
+    class SoundFileDecoder : public Sound::StreamDecoder {
+        SndfileHandle _file;
+        std::vector<Sound::WaveSample> _interleaved;
+
+      public:
+        SoundFileDecoder(const std::string filepath) : _file(filepath.c_str(), SFM_READ, 0, 1, 0) {
+            if (_file.error()) {
+                Log::error("Could not open sound file `{}`: {}", filepath, _file.strError());
+            }
+        }
+
+        unsigned channels() const override { return _file.channels(); }
+
+        double sample_rate() const override { return _file.samplerate(); }
+
+        unsigned frames() const override { return _file.frames(); }
+
+        void seek(unsigned frame) override { _file.seek(frame, SEEK_SET); }
+
+        unsigned read(Sound::Buffer &dst) override {
+            unsigned channels = _file.channels();
+            _interleaved.resize(dst.frames() * channels);
+            unsigned read = _file.readf(_interleaved.data(), dst.frames());
+            Vectorize::deinterleave(_interleaved.data(), dst.data(), channels, read, dst.frames());
+            return read;
+        }
+    };
+
+    /**
+     * @brief Identifies a resampled sound cache file.
+     *
+     */
+    static constexpr char SOUND_CACHE_MAGIC[8] = {'D', 'Y', 'N', 'S', 'O', 'U', 'N', 'D'};
+
+    /**
+     * @brief Header of a resampled sound cache file.
+     *
+     * It is followed by the source file path and the planar samples, which
+     * start at data_offset.
+     *
+     */
+    struct SoundCacheHeader {
+        char magic[8];
+        unsigned version;
+        unsigned frames;
+        unsigned channels;
+        unsigned path_length;
+        long long mtime;
+        unsigned long long data_offset;
+    };
+
+    /**
+     * @brief Decode a sound file and resample it to the standard sample rate.
+     *
+     * @param filepath
+     * @return Sound::Buffer
+     */
+    static Sound::Buffer decode_sound(const std::string &filepath) {
         SndfileHandle file(filepath.c_str(), SFM_READ, 0, 1, 0);
         if (file.error()) {
             Log::error("Could not load sound file `{}`: {}", filepath, file.strError());
@@ -19,19 +90,198 @@ namespace Dynamo {
 
         // Deinterleave the data
         Sound::Buffer raw(frames, channels);
-        for (unsigned f = 0; f < frames; f++) {
-            for (unsigned c = 0; c < channels; c++) {
-                raw[c][f] = interleaved[f * channels + c];
-            }
-        }
+        Vectorize::deinterleave(interleaved.data(), raw.data(), channels, frames);
 
         // Resample the signal
         double scale = Sound::STANDARD_SAMPLE_RATE / sample_rate;
         Sound::Buffer resampled(frames * scale, channels);
+        const Sound::Resampler &resampler = Sound::Resampler::get(sample_rate, Sound::STANDARD_SAMPLE_RATE);
         for (unsigned c = 0; c < channels; c++) {
-            Sound::resample_signal(raw[c], resampled[c], 0, frames, sample_rate, Sound::STANDARD_SAMPLE_RATE);
+            resampler.resample(raw[c], resampled[c], 0, frames);
         }
 
         return resampled;
     }
+
+    /**
+     * @brief Map a cache file into a Buffer if it is valid for the source
+     * file.
+     *
+     * @param cache_path
+     * @param source_path Canonical path of the source file.
+     * @param mtime       Modification time of the source file.
+     * @return std::optional<Sound::Buffer>
+     */
+    static std::optional<Sound::Buffer>
+    map_sound_cache(const std::string &cache_path, const std::string &source_path, long long mtime) {
+        int fd = open(cache_path.c_str(), O_RDONLY);
+        if (fd < 0) return {};
+
+        struct stat info;
+        if (fstat(fd, &info) != 0 || static_cast<std::size_t>(info.st_size) < sizeof(SoundCacheHeader)) {
+            close(fd);
+            return {};
+        }
+
+        // Private writable pages, so edits to the buffer never reach the file
+        std::size_t size = info.st_size;
+        void *base = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (base == MAP_FAILED) return {};
+
+        // Validate the key and the sample count
+        const char *bytes = static_cast<const char *>(base);
+        SoundCacheHeader header;
+        std::memcpy(&header, bytes, sizeof(header));
+        std::size_t samples = static_cast<std::size_t>(header.frames) * header.channels;
+        bool valid = std::memcmp(header.magic, SOUND_CACHE_MAGIC, sizeof(header.magic)) == 0 &&
+                     header.version == Sound::RESAMPLER_VERSION && header.mtime == mtime &&
+                     header.path_length == source_path.size() &&
+                     sizeof(header) + header.path_length <= header.data_offset &&
+                     header.data_offset + samples * sizeof(Sound::WaveSample) == size &&
+                     source_path.compare(0, std::string::npos, bytes + sizeof(header), header.path_length) == 0;
+        if (!valid) {
+            munmap(base, size);
+            return {};
+        }
+
+        Sound::WaveSample *data = reinterpret_cast<Sound::WaveSample *>(static_cast<char *>(base) + header.data_offset);
+        std::shared_ptr<Sound::WaveSample[]> store(data, [base, size](Sound::WaveSample *) { munmap(base, size); });
+        return Sound::Buffer(std::move(store), header.frames, header.channels);
+    }
+
+    /**
+     * @brief Write a resampled sound to a cache file.
+     *
+     * The file is written under a temporary name and renamed, so a partially
+     * written cache is never mapped.
+     *
+     * @param cache_path
+     * @param source_path Canonical path of the source file.
+     * @param mtime       Modification time of the source file.
+     * @param buffer      Resampled sound.
+     */
+    static void write_sound_cache(const std::string &cache_path,
+                                  const std::string &source_path,
+                                  long long mtime,
+                                  const Sound::Buffer &buffer) {
+        SoundCacheHeader header = {};
+        std::memcpy(header.magic, SOUND_CACHE_MAGIC, sizeof(header.magic));
+        header.version = Sound::RESAMPLER_VERSION;
+        header.frames = buffer.frames();
+        header.channels = buffer.channels();
+        header.path_length = source_path.size();
+        header.mtime = mtime;
+        header.data_offset = (sizeof(header) + source_path.size() + 63) & ~63ull;
+
+        // Name the temporary file per thread, as batches load concurrently
+        std::size_t thread = std::hash<std::thread::id>()(std::this_thread::get_id());
+        std::string temp_path = fmt::format("{}.{:x}.tmp", cache_path, thread);
+        std::FILE *file = std::fopen(temp_path.c_str(), "wb");
+        if (file == nullptr) {
+            Log::warn("Could not write sound cache file `{}`.", temp_path);
+            return;
+        }
+
+        std::vector<char> padding(header.data_offset - sizeof(header) - source_path.size(), 0);
+        std::size_t samples = static_cast<std::size_t>(buffer.frames()) * buffer.channels();
+        bool written = std::fwrite(&header, sizeof(header), 1, file) == 1 &&
+                       std::fwrite(source_path.data(), 1, source_path.size(), file) == source_path.size() &&
+                       std::fwrite(padding.data(), 1, padding.size(), file) == padding.size() &&
+                       std::fwrite(buffer.data(), sizeof(Sound::WaveSample), samples, file) == samples;
+        written = std::fclose(file) == 0 && written;
+
+        std::error_code error;
+        if (written) {
+            std::filesystem::rename(temp_path, cache_path, error);
+        }
+        if (!written || error) {
+            Log::warn("Could not write sound cache file `{}`.", cache_path);
+            std::filesystem::remove(temp_path, error);
+        }
+    }
+
+    Sound::Buffer load_sound(const std::string filepath, const std::string cache_directory) {
+        if (cache_directory.empty()) {
+            return decode_sound(filepath);
+        }
+
+        // Key the cache by source path and modification time
+        std::error_code error;
+        std::filesystem::path source_path = std::filesystem::canonical(filepath, error);
+        if (error) {
+            return decode_sound(filepath);
+        }
+        long long mtime = std::filesystem::last_write_time(source_path, error).time_since_epoch().count();
+        std::size_t hash = std::hash<std::string>()(source_path.string());
+        std::filesystem::path cache_path = std::filesystem::path(cache_directory) / fmt::format("{:016x}.pcm", hash);
+
+        // Map the cached samples, or decode and cache them
+        std::optional<Sound::Buffer> cached = map_sound_cache(cache_path.string(), source_path.string(), mtime);
+        if (cached.has_value()) {
+            return std::move(cached.value());
+        }
+
+        Sound::Buffer buffer = decode_sound(filepath);
+        std::filesystem::create_directories(cache_directory, error);
+        write_sound_cache(cache_path.string(), source_path.string(), mtime, buffer);
+        return buffer;
+    }
+
+    void save_sound(const std::string filepath, const Sound::Buffer &buffer, double sample_rate) {
+        SndfileHandle file(filepath.c_str(),
+                           SFM_WRITE,
+                           SF_FORMAT_WAV | SF_FORMAT_FLOAT,
+                           buffer.channels(),
+                           sample_rate);
+        if (file.error()) {
+            Log::error("Could not save sound file `{}`: {}", filepath, file.strError());
+        }
+
+        // Interleave the data
+        std::vector<Sound::WaveSample> interleaved(buffer.frames() * buffer.channels());
+        Vectorize::interleave(buffer.data(), interleaved.data(), buffer.channels(), buffer.frames());
+        file.writef(interleaved.data(), buffer.frames());
+    }
+
+    SoundBatch::SoundBatch(std::vector<std::shared_future<Sound::Buffer>> sounds) : _sounds(std::move(sounds)) {}
+
+    unsigned SoundBatch::size() const { return _sounds.size(); }
+
+    unsigned SoundBatch::loaded() const {
+        unsigned count = 0;
+        for (unsigned i = 0; i < _sounds.size(); i++) {
+            count += ready(i);
+        }
+        return count;
+    }
+
+    float SoundBatch::progress() const { return _sounds.empty() ? 1 : static_cast<float>(loaded()) / size(); }
+
+    bool SoundBatch::ready(unsigned index) const {
+        return _sounds[index].wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+    }
+
+    const Sound::Buffer &SoundBatch::get(unsigned index) const { return _sounds[index].get(); }
+
+    void SoundBatch::wait() const {
+        for (const std::shared_future<Sound::Buffer> &sound : _sounds) {
+            sound.wait();
+        }
+    }
+
+    SoundBatch load_sounds(const std::vector<std::string> &filepaths,
+                           ThreadPool &pool,
+                           const std::string cache_directory) {
+        std::vector<std::shared_future<Sound::Buffer>> sounds;
+        for (const std::string &filepath : filepaths) {
+            sounds.emplace_back(
+                pool.submit([filepath, cache_directory]() { return load_sound(filepath, cache_directory); }));
+        }
+        return SoundBatch(std::move(sounds));
+    }
+
+    std::unique_ptr<Sound::Stream> stream_sound(const std::string filepath) {
+        return std::make_unique<Sound::Stream>(std::make_unique<SoundFileDecoder>(filepath));
+    }
 } // namespace Dynamo
\ No newline at end of file
@@ -1,15 +1,130 @@
 #pragma once
 
+#include <future>
+#include <memory>
+#include <vector>
+
 #include <sndfile.hh>
 
 #include <Sound/Buffer.hpp>
+#include <Sound/Stream.hpp>
+#include <Utils/ThreadPool.hpp>
 
 namespace Dynamo {
     /**
      * @brief Load a sound file.
      *
+     * If a cache directory is given, the resampled samples are written to it
+     * on the first load. Later loads map the cache file directly, as long as
+     * the source file and RESAMPLER_VERSION are unchanged.
+     *
      * @param filepath
+     * @param cache_directory Directory of resampled sound cache files, or
+     * empty to always decode.
      * @return Sound::Buffer
      */
-    Sound::Buffer load_sound(const std::string filepath);
+    Sound::Buffer load_sound(const std::string filepath, const std::string cache_directory = "");
+
+    /**
+     * @brief Save a sound to a 32-bit floating point WAV file, e.g., the
+     * output of an offline Jukebox.
+     *
+     * @param filepath
+     * @param buffer
+     * @param sample_rate
+     */
+    void save_sound(const std::string filepath, const Sound::Buffer &buffer, double sample_rate);
+
+    /**
+     * @brief Sound files being loaded concurrently by load_sounds().
+     *
+     */
+    class SoundBatch {
+        std::vector<std::shared_future<Sound::Buffer>> _sounds;
+
+      public:
+        /**
+         * @brief Construct a new SoundBatch object.
+         *
+         * @param sounds Future to each sound.
+         */
+        SoundBatch(std::vector<std::shared_future<Sound::Buffer>> sounds);
+
+        /**
+         * @brief Get the number of sounds in the batch.
+         *
+         * @return unsigned
+         */
+        unsigned size() const;
+
+        /**
+         * @brief Get the number of sounds that have finished loading,
+         * including those that failed.
+         *
+         * This counts the ready futures, so every sound counted can be
+         * retrieved with get() without blocking.
+         *
+         * @return unsigned
+         */
+        unsigned loaded() const;
+
+        /**
+         * @brief Get the fraction of the sounds that have finished loading.
+         *
+         * @return float
+         */
+        float progress() const;
+
+        /**
+         * @brief Check if a sound has finished loading.
+         *
+         * @param index
+         * @return true
+         * @return false
+         */
+        bool ready(unsigned index) const;
+
+        /**
+         * @brief Wait for a sound to load and get it.
+         *
+         * This rethrows the error if the sound could not be loaded.
+         *
+         * @param index
+         * @return const Sound::Buffer&
+         */
+        const Sound::Buffer &get(unsigned index) const;
+
+        /**
+         * @brief Wait for all the sounds to finish loading.
+         *
+         */
+        void wait() const;
+    };
+
+    /**
+     * @brief Load sound files concurrently on a thread pool.
+     *
+     * Each file is decoded and resampled by a separate job, so a pool with
+     * more threads than cores also overlaps file reads with resampling.
+     *
+     * @param filepaths
+     * @param pool
+     * @param cache_directory Directory of resampled sound cache files, or
+     * empty to always decode.
+     * @return SoundBatch
+     */
+    SoundBatch load_sounds(const std::vector<std::string> &filepaths,
+                           ThreadPool &pool,
+                           const std::string cache_directory = "");
+
+    /**
+     * @brief Open a sound file for streaming.
+     *
+     * Unlike load_sound(), the file is decoded on a background thread as it
+     * is played, so memory use does not depend on the length of the sound.
+     *
+     * @param filepath
+     * @return std::unique_ptr<Sound::Stream>
+     */
+    std::unique_ptr<Sound::Stream> stream_sound(const std::string filepath);
 } // namespace Dynamo
\ No newline at end of file
@@ -25,8 +25,10 @@
 #include <Object/Object.hpp>
 #include <Object/Ref.hpp>
 #include <Sound/Buffer.hpp>
+#include <Sound/DSP/Ambisonics.hpp>
 #include <Sound/DSP/Convolver.hpp>
 #include <Sound/DSP/HRTF.hpp>
+#include <Sound/DSP/NonUniformConvolver.hpp>
 #include <Sound/DSP/Resample.hpp>
 #include <Sound/Device.hpp>
 #include <Sound/Filter.hpp>
@@ -37,7 +39,9 @@
 #include <Sound/Filters/Stereo.hpp>
 #include <Sound/Jukebox.hpp>
 #include <Sound/Listener.hpp>
+#include <Sound/PackedBuffer.hpp>
 #include <Sound/Source.hpp>
+#include <Sound/Stream.hpp>
 #include <Utils/Allocator.hpp>
 #include <Utils/Bits.hpp>
 #include <Utils/IdGenerator.hpp>
@@ -64,6 +64,72 @@ namespace Dynamo::Vectorize::AVX {
         SSE::vsma(src, scalar, dst, rem);
     }
 
+    inline void vcma(const float *src_a_re,
+                     const float *src_a_im,
+                     const float *src_b_re,
+                     const float *src_b_im,
+                     float *dst_re,
+                     float *dst_im,
+                     unsigned length) {
+        unsigned rem = length % 8;
+        float *dst_end = dst_re + length - rem;
+        while (dst_re < dst_end) {
+            __m256 a_re = _mm256_loadu_ps(src_a_re);
+            __m256 a_im = _mm256_loadu_ps(src_a_im);
+            __m256 b_re = _mm256_loadu_ps(src_b_re);
+            __m256 b_im = _mm256_loadu_ps(src_b_im);
+
+            __m256 re = _mm256_fmadd_ps(a_re, b_re, _mm256_loadu_ps(dst_re));
+            __m256 im = _mm256_fmadd_ps(a_re, b_im, _mm256_loadu_ps(dst_im));
+            _mm256_storeu_ps(dst_re, _mm256_fnmadd_ps(a_im, b_im, re));
+            _mm256_storeu_ps(dst_im, _mm256_fmadd_ps(a_im, b_re, im));
+
+            src_a_re += 8;
+            src_a_im += 8;
+            src_b_re += 8;
+            src_b_im += 8;
+            dst_re += 8;
+            dst_im += 8;
+        }
+        SSE::vcma(src_a_re, src_a_im, src_b_re, src_b_im, dst_re, dst_im, rem);
+    }
+
+    inline void i16tof(const std::int16_t *src, const float scalar, float *dst, unsigned length) {
+        __m256 scalar_v = _mm256_set1_ps(scalar);
+        unsigned rem = length % 8;
+        float *dst_end = dst + length - rem;
+        while (dst < dst_end) {
+            // Sign-extend each half to 32-bit integers
+            __m128i src_v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+            __m128i lo_v = _mm_cvtepi16_epi32(src_v);
+            __m128i hi_v = _mm_cvtepi16_epi32(_mm_unpackhi_epi64(src_v, src_v));
+            __m256i ext_v = _mm256_insertf128_si256(_mm256_castsi128_si256(lo_v), hi_v, 1);
+            _mm256_storeu_ps(dst, _mm256_mul_ps(_mm256_cvtepi32_ps(ext_v), scalar_v));
+            src += 8;
+            dst += 8;
+        }
+        SSE::i16tof(src, scalar, dst, rem);
+    }
+
+    inline float vdot(const float *src_a, const float *src_b, unsigned length) {
+        __m256 sum_v = _mm256_setzero_ps();
+        unsigned rem = length % 8;
+        const float *src_end = src_a + length - rem;
+        while (src_a < src_end) {
+            __m256 a_v = _mm256_loadu_ps(src_a);
+            __m256 b_v = _mm256_loadu_ps(src_b);
+            sum_v = _mm256_fmadd_ps(a_v, b_v, sum_v);
+            src_a += 8;
+            src_b += 8;
+        }
+
+        // Horizontal sum
+        __m128 sum_4 = _mm_add_ps(_mm256_castps256_ps128(sum_v), _mm256_extractf128_ps(sum_v, 1));
+        sum_4 = _mm_add_ps(sum_4, _mm_movehl_ps(sum_4, sum_4));
+        sum_4 = _mm_add_ss(sum_4, _mm_shuffle_ps(sum_4, sum_4, _MM_SHUFFLE(1, 1, 1, 1)));
+        return _mm_cvtss_f32(sum_4) + SSE::vdot(src_a, src_b, rem);
+    }
+
     inline void vclamp(const float *src, const float lo, const float hi, float *dst, unsigned length) {
         __m256 lo_v = _mm256_set1_ps(lo);
         __m256 hi_v = _mm256_set1_ps(hi);
@@ -78,4 +144,320 @@ namespace Dynamo::Vectorize::AVX {
         }
         SSE::vclamp(src, lo, hi, dst, rem);
     }
+
+    inline void transpose_lanes(__m256 &r0, __m256 &r1, __m256 &r2, __m256 &r3) {
+        // Transpose the 4x4 matrix in each 128-bit lane
+        __m256 t0 = _mm256_unpacklo_ps(r0, r1);
+        __m256 t1 = _mm256_unpacklo_ps(r2, r3);
+        __m256 t2 = _mm256_unpackhi_ps(r0, r1);
+        __m256 t3 = _mm256_unpackhi_ps(r2, r3);
+        r0 = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(1, 0, 1, 0));
+        r1 = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(3, 2, 3, 2));
+        r2 = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(1, 0, 1, 0));
+        r3 = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(3, 2, 3, 2));
+    }
+
+    inline void store_frames_6(float *frame, __m128 r0, __m128 r1, __m128 r2, __m128 r3, __m128 p_lo, __m128 p_hi) {
+        _mm_storeu_ps(frame, r0);
+        _mm_storel_pi(reinterpret_cast<__m64 *>(frame + 4), p_lo);
+        _mm_storeu_ps(frame + 6, r1);
+        _mm_storeh_pi(reinterpret_cast<__m64 *>(frame + 10), p_lo);
+        _mm_storeu_ps(frame + 12, r2);
+        _mm_storel_pi(reinterpret_cast<__m64 *>(frame + 16), p_hi);
+        _mm_storeu_ps(frame + 18, r3);
+        _mm_storeh_pi(reinterpret_cast<__m64 *>(frame + 22), p_hi);
+    }
+
+    inline __m256 load_pairs_6(const float *lo, const float *hi) {
+        __m128 lo_v = _mm_setzero_ps();
+        lo_v = _mm_loadl_pi(lo_v, reinterpret_cast<const __m64 *>(lo + 4));
+        lo_v = _mm_loadh_pi(lo_v, reinterpret_cast<const __m64 *>(lo + 10));
+
+        __m128 hi_v = _mm_setzero_ps();
+        hi_v = _mm_loadl_pi(hi_v, reinterpret_cast<const __m64 *>(hi + 4));
+        hi_v = _mm_loadh_pi(hi_v, reinterpret_cast<const __m64 *>(hi + 10));
+        return _mm256_insertf128_ps(_mm256_castps128_ps256(lo_v), hi_v, 1);
+    }
+
+    inline __m256 load_lanes(const float *lo, const float *hi) {
+        return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(lo)), _mm_loadu_ps(hi), 1);
+    }
+
+    inline void interleave(const float *src, float *dst, unsigned channels, unsigned length, unsigned stride) {
+        unsigned rem = length % 8;
+        unsigned end = length - rem;
+        switch (channels) {
+        case 2:
+            for (unsigned i = 0; i < end; i += 8) {
+                __m256 c0 = _mm256_loadu_ps(src + i);
+                __m256 c1 = _mm256_loadu_ps(src + stride + i);
+                __m256 lo = _mm256_unpacklo_ps(c0, c1);
+                __m256 hi = _mm256_unpackhi_ps(c0, c1);
+                _mm256_storeu_ps(dst + 2 * i, _mm256_permute2f128_ps(lo, hi, 0x20));
+                _mm256_storeu_ps(dst + 2 * i + 8, _mm256_permute2f128_ps(lo, hi, 0x31));
+            }
+            break;
+        case 4:
+            for (unsigned i = 0; i < end; i += 8) {
+                __m256 r0 = _mm256_loadu_ps(src + i);
+                __m256 r1 = _mm256_loadu_ps(src + stride + i);
+                __m256 r2 = _mm256_loadu_ps(src + 2 * stride + i);
+                __m256 r3 = _mm256_loadu_ps(src + 3 * stride + i);
+                transpose_lanes(r0, r1, r2, r3);
+
+                float *frame = dst + 4 * i;
+                _mm256_storeu_ps(frame, _mm256_permute2f128_ps(r0, r1, 0x20));
+                _mm256_storeu_ps(frame + 8, _mm256_permute2f128_ps(r2, r3, 0x20));
+                _mm256_storeu_ps(frame + 16, _mm256_permute2f128_ps(r0, r1, 0x31));
+                _mm256_storeu_ps(frame + 24, _mm256_permute2f128_ps(r2, r3, 0x31));
+            }
+            break;
+        case 6:
+            for (unsigned i = 0; i < end; i += 8) {
+                __m256 r0 = _mm256_loadu_ps(src + i);
+                __m256 r1 = _mm256_loadu_ps(src + stride + i);
+                __m256 r2 = _mm256_loadu_ps(src + 2 * stride + i);
+                __m256 r3 = _mm256_loadu_ps(src + 3 * stride + i);
+                transpose_lanes(r0, r1, r2, r3);
+
+                __m256 c4 = _mm256_loadu_ps(src + 4 * stride + i);
+                __m256 c5 = _mm256_loadu_ps(src + 5 * stride + i);
+                __m256 p_lo = _mm256_unpacklo_ps(c4, c5);
+                __m256 p_hi = _mm256_unpackhi_ps(c4, c5);
+
+                float *frame = dst + 6 * i;
+                store_frames_6(frame,
+                               _mm256_castps256_ps128(r0),
+                               _mm256_castps256_ps128(r1),
+                               _mm256_castps256_ps128(r2),
+                               _mm256_castps256_ps128(r3),
+                               _mm256_castps256_ps128(p_lo),
+                               _mm256_castps256_ps128(p_hi));
+                store_frames_6(frame + 24,
+                               _mm256_extractf128_ps(r0, 1),
+                               _mm256_extractf128_ps(r1, 1),
+                               _mm256_extractf128_ps(r2, 1),
+                               _mm256_extractf128_ps(r3, 1),
+                               _mm256_extractf128_ps(p_lo, 1),
+                               _mm256_extractf128_ps(p_hi, 1));
+            }
+            break;
+        case 8:
+            for (unsigned i = 0; i < end; i += 8) {
+                __m256 r0 = _mm256_loadu_ps(src + i);
+                __m256 r1 = _mm256_loadu_ps(src + stride + i);
+                __m256 r2 = _mm256_loadu_ps(src + 2 * stride + i);
+                __m256 r3 = _mm256_loadu_ps(src + 3 * stride + i);
+                transpose_lanes(r0, r1, r2, r3);
+
+                __m256 s0 = _mm256_loadu_ps(src + 4 * stride + i);
+                __m256 s1 = _mm256_loadu_ps(src + 5 * stride + i);
+                __m256 s2 = _mm256_loadu_ps(src + 6 * stride + i);
+                __m256 s3 = _mm256_loadu_ps(src + 7 * stride + i);
+                transpose_lanes(s0, s1, s2, s3);
+
+                float *frame = dst + 8 * i;
+                _mm256_storeu_ps(frame, _mm256_permute2f128_ps(r0, s0, 0x20));
+                _mm256_storeu_ps(frame + 8, _mm256_permute2f128_ps(r1, s1, 0x20));
+                _mm256_storeu_ps(frame + 16, _mm256_permute2f128_ps(r2, s2, 0x20));
+                _mm256_storeu_ps(frame + 24, _mm256_permute2f128_ps(r3, s3, 0x20));
+                _mm256_storeu_ps(frame + 32, _mm256_permute2f128_ps(r0, s0, 0x31));
+                _mm256_storeu_ps(frame + 40, _mm256_permute2f128_ps(r1, s1, 0x31));
+                _mm256_storeu_ps(frame + 48, _mm256_permute2f128_ps(r2, s2, 0x31));
+                _mm256_storeu_ps(frame + 56, _mm256_permute2f128_ps(r3, s3, 0x31));
+            }
+            break;
+        default:
+            rem = length;
+            end = 0;
+            break;
+        }
+        SSE::interleave(src + end, dst + end * channels, channels, rem, stride);
+    }
+
+    inline void deinterleave(const float *src, float *dst, unsigned channels, unsigned length, unsigned stride) {
+        unsigned rem = length % 8;
+        unsigned end = length - rem;
+        switch (channels) {
+        case 2:
+            for (unsigned i = 0; i < end; i += 8) {
+                __m256 f03 = _mm256_loadu_ps(src + 2 * i);
+                __m256 f47 = _mm256_loadu_ps(src + 2 * i + 8);
+                __m256 t0 = _mm256_permute2f128_ps(f03, f47, 0x20);
+                __m256 t1 = _mm256_permute2f128_ps(f03, f47, 0x31);
+                _mm256_storeu_ps(dst + i, _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(2, 0, 2, 0)));
+                _mm256_storeu_ps(dst + stride + i, _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(3, 1, 3, 1)));
+            }
+            break;
+        case 4:
+            for (unsigned i = 0; i < end; i += 8) {
+                const float *frame = src + 4 * i;
+                __m256 f01 = _mm256_loadu_ps(frame);
+                __m256 f23 = _mm256_loadu_ps(frame + 8);
+                __m256 f45 = _mm256_loadu_ps(frame + 16);
+                __m256 f67 = _mm256_loadu_ps(frame + 24);
+
+                __m256 r0 = _mm256_permute2f128_ps(f01, f45, 0x20);
+                __m256 r1 = _mm256_permute2f128_ps(f01, f45, 0x31);
+                __m256 r2 = _mm256_permute2f128_ps(f23, f67, 0x20);
+                __m256 r3 = _mm256_permute2f128_ps(f23, f67, 0x31);
+                transpose_lanes(r0, r1, r2, r3);
+
+                _mm256_storeu_ps(dst + i, r0);
+                _mm256_storeu_ps(dst + stride + i, r1);
+                _mm256_storeu_ps(dst + 2 * stride + i, r2);
+                _mm256_storeu_ps(dst + 3 * stride + i, r3);
+            }
+            break;
+        case 6:
+            for (unsigned i = 0; i < end; i += 8) {
+                const float *frame = src + 6 * i;
+                __m256 r0 = load_lanes(frame, frame + 24);
+                __m256 r1 = load_lanes(frame + 6, frame + 30);
+                __m256 r2 = load_lanes(frame + 12, frame + 36);
+                __m256 r3 = load_lanes(frame + 18, frame + 42);
+                transpose_lanes(r0, r1, r2, r3);
+
+                __m256 p_lo = load_pairs_6(frame, frame + 24);
+                __m256 p_hi = load_pairs_6(frame + 12, frame + 36);
+
+                _mm256_storeu_ps(dst + i, r0);
+                _mm256_storeu_ps(dst + stride + i, r1);
+                _mm256_storeu_ps(dst + 2 * stride + i, r2);
+                _mm256_storeu_ps(dst + 3 * stride + i, r3);
+                _mm256_storeu_ps(dst + 4 * stride + i, _mm256_shuffle_ps(p_lo, p_hi, _MM_SHUFFLE(2, 0, 2, 0)));
+                _mm256_storeu_ps(dst + 5 * stride + i, _mm256_shuffle_ps(p_lo, p_hi, _MM_SHUFFLE(3, 1, 3, 1)));
+            }
+            break;
+        case 8:
+            for (unsigned i = 0; i < end; i += 8) {
+                const float *frame = src + 8 * i;
+                __m256 f0 = _mm256_loadu_ps(frame);
+                __m256 f1 = _mm256_loadu_ps(frame + 8);
+                __m256 f2 = _mm256_loadu_ps(frame + 16);
+                __m256 f3 = _mm256_loadu_ps(frame + 24);
+                __m256 f4 = _mm256_loadu_ps(frame + 32);
+                __m256 f5 = _mm256_loadu_ps(frame + 40);
+                __m256 f6 = _mm256_loadu_ps(frame + 48);
+                __m256 f7 = _mm256_loadu_ps(frame + 56);
+
+                __m256 r0 = _mm256_permute2f128_ps(f0, f4, 0x20);
+                __m256 r1 = _mm256_permute2f128_ps(f1, f5, 0x20);
+                __m256 r2 = _mm256_permute2f128_ps(f2, f6, 0x20);
+                __m256 r3 = _mm256_permute2f128_ps(f3, f7, 0x20);
+                transpose_lanes(r0, r1, r2, r3);
+
+                __m256 s0 = _mm256_permute2f128_ps(f0, f4, 0x31);
+                __m256 s1 = _mm256_permute2f128_ps(f1, f5, 0x31);
+                __m256 s2 = _mm256_permute2f128_ps(f2, f6, 0x31);
+                __m256 s3 = _mm256_permute2f128_ps(f3, f7, 0x31);
+                transpose_lanes(s0, s1, s2, s3);
+
+                _mm256_storeu_ps(dst + i, r0);
+                _mm256_storeu_ps(dst + stride + i, r1);
+                _mm256_storeu_ps(dst + 2 * stride + i, r2);
+                _mm256_storeu_ps(dst + 3 * stride + i, r3);
+                _mm256_storeu_ps(dst + 4 * stride + i, s0);
+                _mm256_storeu_ps(dst + 5 * stride + i, s1);
+                _mm256_storeu_ps(dst + 6 * stride + i, s2);
+                _mm256_storeu_ps(dst + 7 * stride + i, s3);
+            }
+            break;
+        default:
+            rem = length;
+            end = 0;
+            break;
+        }
+        SSE::deinterleave(src + end * channels, dst + end, channels, rem, stride);
+    }
+
+    inline __m256 cmul(__m256 a, __m256 w) {
+        // (a_re * w_re - a_im * w_im, a_im * w_re + a_re * w_im)
+        __m256 w_re = _mm256_moveldup_ps(w);
+        __m256 w_im = _mm256_movehdup_ps(w);
+        __m256 a_swap = _mm256_permute_ps(a, _MM_SHUFFLE(2, 3, 0, 1));
+        return _mm256_fmaddsub_ps(a, w_re, _mm256_mul_ps(a_swap, w_im));
+    }
+
+    inline void radix4(float *signal, const float *twiddles, unsigned stride, unsigned length, bool inverse) {
+        float *x0 = signal;
+        float *x1 = x0 + stride * 2;
+        float *x2 = x1 + stride * 2;
+        float *x3 = x2 + stride * 2;
+        const float *w1 = twiddles;
+        const float *w2 = w1 + stride * 2;
+        const float *w3 = w2 + stride * 2;
+
+        // Multiplying by -i (forward) or i (inverse) swaps the parts and
+        // negates one of them
+        __m256 rotate = inverse ? _mm256_set_ps(0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f)
+                                : _mm256_set_ps(-0.0f, 0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f, 0.0f);
+
+        unsigned rem = length % 4;
+        unsigned end = (length - rem) * 2;
+        for (unsigned j = 0; j < end; j += 8) {
+            __m256 a = _mm256_loadu_ps(x0 + j);
+            __m256 b = cmul(_mm256_loadu_ps(x1 + j), _mm256_loadu_ps(w1 + j));
+            __m256 c = cmul(_mm256_loadu_ps(x2 + j), _mm256_loadu_ps(w2 + j));
+            __m256 d = cmul(_mm256_loadu_ps(x3 + j), _mm256_loadu_ps(w3 + j));
+
+            __m256 ab = _mm256_add_ps(a, b);
+            __m256 ab_1 = _mm256_sub_ps(a, b);
+            __m256 cd = _mm256_add_ps(c, d);
+            __m256 cd_1 = _mm256_sub_ps(c, d);
+            cd_1 = _mm256_xor_ps(_mm256_permute_ps(cd_1, _MM_SHUFFLE(2, 3, 0, 1)), rotate);
+
+            _mm256_storeu_ps(x0 + j, _mm256_add_ps(ab, cd));
+            _mm256_storeu_ps(x1 + j, _mm256_add_ps(ab_1, cd_1));
+            _mm256_storeu_ps(x2 + j, _mm256_sub_ps(ab, cd));
+            _mm256_storeu_ps(x3 + j, _mm256_sub_ps(ab_1, cd_1));
+        }
+        SSE::radix4(signal + end, twiddles + end, stride, rem, inverse);
+    }
+
+    inline void radix4_lanes(float *signal,
+                             const float *twiddles,
+                             unsigned stride,
+                             unsigned twiddle_stride,
+                             unsigned length,
+                             bool inverse) {
+        float *x0 = signal;
+        float *x1 = x0 + stride * 2;
+        float *x2 = x1 + stride * 2;
+        float *x3 = x2 + stride * 2;
+
+        // Broadcast each twiddle factor to every complex lane
+        const float *w1 = twiddles;
+        const float *w2 = w1 + twiddle_stride * 2;
+        const float *w3 = w2 + twiddle_stride * 2;
+        __m256 v1 = _mm256_setr_ps(w1[0], w1[1], w1[0], w1[1], w1[0], w1[1], w1[0], w1[1]);
+        __m256 v2 = _mm256_setr_ps(w2[0], w2[1], w2[0], w2[1], w2[0], w2[1], w2[0], w2[1]);
+        __m256 v3 = _mm256_setr_ps(w3[0], w3[1], w3[0], w3[1], w3[0], w3[1], w3[0], w3[1]);
+
+        // Multiplying by -i (forward) or i (inverse) swaps the parts and
+        // negates one of them
+        __m256 rotate = inverse ? _mm256_set_ps(0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f)
+                                : _mm256_set_ps(-0.0f, 0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f, 0.0f);
+
+        unsigned rem = length % 4;
+        unsigned end = (length - rem) * 2;
+        for (unsigned j = 0; j < end; j += 8) {
+            __m256 a = _mm256_loadu_ps(x0 + j);
+            __m256 b = cmul(_mm256_loadu_ps(x1 + j), v1);
+            __m256 c = cmul(_mm256_loadu_ps(x2 + j), v2);
+            __m256 d = cmul(_mm256_loadu_ps(x3 + j), v3);
+
+            __m256 ab = _mm256_add_ps(a, b);
+            __m256 ab_1 = _mm256_sub_ps(a, b);
+            __m256 cd = _mm256_add_ps(c, d);
+            __m256 cd_1 = _mm256_sub_ps(c, d);
+            cd_1 = _mm256_xor_ps(_mm256_permute_ps(cd_1, _MM_SHUFFLE(2, 3, 0, 1)), rotate);
+
+            _mm256_storeu_ps(x0 + j, _mm256_add_ps(ab, cd));
+            _mm256_storeu_ps(x1 + j, _mm256_add_ps(ab_1, cd_1));
+            _mm256_storeu_ps(x2 + j, _mm256_sub_ps(ab, cd));
+            _mm256_storeu_ps(x3 + j, _mm256_sub_ps(ab_1, cd_1));
+        }
+        SSE::radix4_lanes(signal + end, twiddles, stride, twiddle_stride, rem, inverse);
+    }
 } // namespace Dynamo::Vectorize::AVX
\ No newline at end of file
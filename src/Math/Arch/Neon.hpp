@@ -145,6 +145,63 @@ namespace Dynamo::Vectorize::Neon {
         Scalar::vsma(src, scalar, dst, rem_1);
     }
 
+    inline void vcma(const float *src_a_re,
+                     const float *src_a_im,
+                     const float *src_b_re,
+                     const float *src_b_im,
+                     float *dst_re,
+                     float *dst_im,
+                     unsigned length) {
+        unsigned rem = length % 4;
+        float *dst_end = dst_re + length - rem;
+        while (dst_re < dst_end) {
+            float32x4_t a_re = vld1q_f32(src_a_re);
+            float32x4_t a_im = vld1q_f32(src_a_im);
+            float32x4_t b_re = vld1q_f32(src_b_re);
+            float32x4_t b_im = vld1q_f32(src_b_im);
+
+            float32x4_t re = vmlaq_f32(vld1q_f32(dst_re), a_re, b_re);
+            float32x4_t im = vmlaq_f32(vld1q_f32(dst_im), a_re, b_im);
+            vst1q_f32(dst_re, vmlsq_f32(re, a_im, b_im));
+            vst1q_f32(dst_im, vmlaq_f32(im, a_im, b_re));
+
+            src_a_re += 4;
+            src_a_im += 4;
+            src_b_re += 4;
+            src_b_im += 4;
+            dst_re += 4;
+            dst_im += 4;
+        }
+        Scalar::vcma(src_a_re, src_a_im, src_b_re, src_b_im, dst_re, dst_im, rem);
+    }
+
+    inline void i16tof(const std::int16_t *src, const float scalar, float *dst, unsigned length) {
+        unsigned rem = length % 8;
+        float *dst_end = dst + length - rem;
+        while (dst < dst_end) {
+            int16x8_t src_v = vld1q_s16(src);
+            float32x4_t lo_v = vcvtq_f32_s32(vmovl_s16(vget_low_s16(src_v)));
+            float32x4_t hi_v = vcvtq_f32_s32(vmovl_high_s16(src_v));
+            vst1q_f32(dst, vmulq_n_f32(lo_v, scalar));
+            vst1q_f32(dst + 4, vmulq_n_f32(hi_v, scalar));
+            src += 8;
+            dst += 8;
+        }
+        Scalar::i16tof(src, scalar, dst, rem);
+    }
+
+    inline float vdot(const float *src_a, const float *src_b, unsigned length) {
+        float32x4_t sum_v = vdupq_n_f32(0);
+        unsigned rem = length % 4;
+        const float *src_end = src_a + length - rem;
+        while (src_a < src_end) {
+            sum_v = vmlaq_f32(sum_v, vld1q_f32(src_a), vld1q_f32(src_b));
+            src_a += 4;
+            src_b += 4;
+        }
+        return vaddvq_f32(sum_v) + Scalar::vdot(src_a, src_b, rem);
+    }
+
     inline void vclamp(const float *src, const float lo, const float hi, float *dst, unsigned length) {
         float32x4_t lo_v = vdupq_n_f32(lo);
         float32x4_t hi_v = vdupq_n_f32(hi);
@@ -178,4 +235,237 @@ namespace Dynamo::Vectorize::Neon {
 
         Scalar::vclamp(src, lo, hi, dst, rem_1);
     }
+
+    inline void interleave(const float *src, float *dst, unsigned channels, unsigned length, unsigned stride) {
+        unsigned rem = length % 4;
+        unsigned end = length - rem;
+        switch (channels) {
+        case 2:
+            for (unsigned i = 0; i < end; i += 4) {
+                float32x4x2_t src_m = {vld1q_f32(src + i), vld1q_f32(src + stride + i)};
+                vst2q_f32(dst + 2 * i, src_m);
+            }
+            break;
+        case 4:
+            for (unsigned i = 0; i < end; i += 4) {
+                float32x4x4_t src_m = {
+                    vld1q_f32(src + i),
+                    vld1q_f32(src + stride + i),
+                    vld1q_f32(src + 2 * stride + i),
+                    vld1q_f32(src + 3 * stride + i),
+                };
+                vst4q_f32(dst + 4 * i, src_m);
+            }
+            break;
+        case 6:
+            for (unsigned i = 0; i < end; i += 4) {
+                // Pair up adjacent channels
+                float32x4x2_t p01 = vzipq_f32(vld1q_f32(src + i), vld1q_f32(src + stride + i));
+                float32x4x2_t p23 = vzipq_f32(vld1q_f32(src + 2 * stride + i), vld1q_f32(src + 3 * stride + i));
+                float32x4x2_t p45 = vzipq_f32(vld1q_f32(src + 4 * stride + i), vld1q_f32(src + 5 * stride + i));
+
+                float *frame = dst + 6 * i;
+                for (unsigned k = 0; k < 2; k++) {
+                    vst1q_f32(frame, vcombine_f32(vget_low_f32(p01.val[k]), vget_low_f32(p23.val[k])));
+                    vst1q_f32(frame + 4, vcombine_f32(vget_low_f32(p45.val[k]), vget_high_f32(p01.val[k])));
+                    vst1q_f32(frame + 8, vcombine_f32(vget_high_f32(p23.val[k]), vget_high_f32(p45.val[k])));
+                    frame += 12;
+                }
+            }
+            break;
+        case 8:
+            for (unsigned i = 0; i < end; i += 4) {
+                // Pair up adjacent channels
+                float32x4x2_t p01 = vzipq_f32(vld1q_f32(src + i), vld1q_f32(src + stride + i));
+                float32x4x2_t p23 = vzipq_f32(vld1q_f32(src + 2 * stride + i), vld1q_f32(src + 3 * stride + i));
+                float32x4x2_t p45 = vzipq_f32(vld1q_f32(src + 4 * stride + i), vld1q_f32(src + 5 * stride + i));
+                float32x4x2_t p67 = vzipq_f32(vld1q_f32(src + 6 * stride + i), vld1q_f32(src + 7 * stride + i));
+
+                float *frame = dst + 8 * i;
+                for (unsigned k = 0; k < 2; k++) {
+                    vst1q_f32(frame, vcombine_f32(vget_low_f32(p01.val[k]), vget_low_f32(p23.val[k])));
+                    vst1q_f32(frame + 4, vcombine_f32(vget_low_f32(p45.val[k]), vget_low_f32(p67.val[k])));
+                    vst1q_f32(frame + 8, vcombine_f32(vget_high_f32(p01.val[k]), vget_high_f32(p23.val[k])));
+                    vst1q_f32(frame + 12, vcombine_f32(vget_high_f32(p45.val[k]), vget_high_f32(p67.val[k])));
+                    frame += 16;
+                }
+            }
+            break;
+        default:
+            rem = length;
+            end = 0;
+            break;
+        }
+        Scalar::interleave(src + end, dst + end * channels, channels, rem, stride);
+    }
+
+    inline void deinterleave(const float *src, float *dst, unsigned channels, unsigned length, unsigned stride) {
+        unsigned rem = length % 4;
+        unsigned end = length - rem;
+        switch (channels) {
+        case 2:
+            for (unsigned i = 0; i < end; i += 4) {
+                float32x4x2_t src_m = vld2q_f32(src + 2 * i);
+                vst1q_f32(dst + i, src_m.val[0]);
+                vst1q_f32(dst + stride + i, src_m.val[1]);
+            }
+            break;
+        case 4:
+            for (unsigned i = 0; i < end; i += 4) {
+                float32x4x4_t src_m = vld4q_f32(src + 4 * i);
+                vst1q_f32(dst + i, src_m.val[0]);
+                vst1q_f32(dst + stride + i, src_m.val[1]);
+                vst1q_f32(dst + 2 * stride + i, src_m.val[2]);
+                vst1q_f32(dst + 3 * stride + i, src_m.val[3]);
+            }
+            break;
+        case 6:
+            for (unsigned i = 0; i < end; i += 4) {
+                const float *frame = src + 6 * i;
+                float32x4_t x0 = vld1q_f32(frame);
+                float32x4_t x1 = vld1q_f32(frame + 4);
+                float32x4_t x2 = vld1q_f32(frame + 8);
+                float32x4_t x3 = vld1q_f32(frame + 12);
+                float32x4_t x4 = vld1q_f32(frame + 16);
+                float32x4_t x5 = vld1q_f32(frame + 20);
+
+                // Gather channel pairs across frames, then unzip
+                float32x4x2_t c01 = vuzpq_f32(vcombine_f32(vget_low_f32(x0), vget_high_f32(x1)),
+                                              vcombine_f32(vget_low_f32(x3), vget_high_f32(x4)));
+                float32x4x2_t c23 = vuzpq_f32(vcombine_f32(vget_high_f32(x0), vget_low_f32(x2)),
+                                              vcombine_f32(vget_high_f32(x3), vget_low_f32(x5)));
+                float32x4x2_t c45 = vuzpq_f32(vcombine_f32(vget_low_f32(x1), vget_high_f32(x2)),
+                                              vcombine_f32(vget_low_f32(x4), vget_high_f32(x5)));
+
+                vst1q_f32(dst + i, c01.val[0]);
+                vst1q_f32(dst + stride + i, c01.val[1]);
+                vst1q_f32(dst + 2 * stride + i, c23.val[0]);
+                vst1q_f32(dst + 3 * stride + i, c23.val[1]);
+                vst1q_f32(dst + 4 * stride + i, c45.val[0]);
+                vst1q_f32(dst + 5 * stride + i, c45.val[1]);
+            }
+            break;
+        case 8:
+            for (unsigned i = 0; i < end; i += 4) {
+                const float *frame = src + 8 * i;
+                float32x4x4_t f01 = vld1q_f32_x4(frame);
+                float32x4x4_t f23 = vld1q_f32_x4(frame + 16);
+
+                // Gather channel pairs across frames, then unzip
+                float32x4x2_t c01 = vuzpq_f32(vcombine_f32(vget_low_f32(f01.val[0]), vget_low_f32(f01.val[2])),
+                                              vcombine_f32(vget_low_f32(f23.val[0]), vget_low_f32(f23.val[2])));
+                float32x4x2_t c23 = vuzpq_f32(vcombine_f32(vget_high_f32(f01.val[0]), vget_high_f32(f01.val[2])),
+                                              vcombine_f32(vget_high_f32(f23.val[0]), vget_high_f32(f23.val[2])));
+                float32x4x2_t c45 = vuzpq_f32(vcombine_f32(vget_low_f32(f01.val[1]), vget_low_f32(f01.val[3])),
+                                              vcombine_f32(vget_low_f32(f23.val[1]), vget_low_f32(f23.val[3])));
+                float32x4x2_t c67 = vuzpq_f32(vcombine_f32(vget_high_f32(f01.val[1]), vget_high_f32(f01.val[3])),
+                                              vcombine_f32(vget_high_f32(f23.val[1]), vget_high_f32(f23.val[3])));
+
+                vst1q_f32(dst + i, c01.val[0]);
+                vst1q_f32(dst + stride + i, c01.val[1]);
+                vst1q_f32(dst + 2 * stride + i, c23.val[0]);
+                vst1q_f32(dst + 3 * stride + i, c23.val[1]);
+                vst1q_f32(dst + 4 * stride + i, c45.val[0]);
+                vst1q_f32(dst + 5 * stride + i, c45.val[1]);
+                vst1q_f32(dst + 6 * stride + i, c67.val[0]);
+                vst1q_f32(dst + 7 * stride + i, c67.val[1]);
+            }
+            break;
+        default:
+            rem = length;
+            end = 0;
+            break;
+        }
+        Scalar::deinterleave(src + end * channels, dst + end, channels, rem, stride);
+    }
+
+    inline float32x4x2_t cmul(float32x4x2_t a, float32x4x2_t w) {
+        float32x4_t re = vmlsq_f32(vmulq_f32(a.val[0], w.val[0]), a.val[1], w.val[1]);
+        float32x4_t im = vmlaq_f32(vmulq_f32(a.val[0], w.val[1]), a.val[1], w.val[0]);
+        return {re, im};
+    }
+
+    inline void radix4(float *signal, const float *twiddles, unsigned stride, unsigned length, bool inverse) {
+        float *x0 = signal;
+        float *x1 = x0 + stride * 2;
+        float *x2 = x1 + stride * 2;
+        float *x3 = x2 + stride * 2;
+        const float *w1 = twiddles;
+        const float *w2 = w1 + stride * 2;
+        const float *w3 = w2 + stride * 2;
+        float32x4_t sign = vdupq_n_f32(inverse ? -1 : 1);
+
+        unsigned rem = length % 4;
+        unsigned end = (length - rem) * 2;
+        for (unsigned j = 0; j < end; j += 8) {
+            float32x4x2_t a = vld2q_f32(x0 + j);
+            float32x4x2_t b = cmul(vld2q_f32(x1 + j), vld2q_f32(w1 + j));
+            float32x4x2_t c = cmul(vld2q_f32(x2 + j), vld2q_f32(w2 + j));
+            float32x4x2_t d = cmul(vld2q_f32(x3 + j), vld2q_f32(w3 + j));
+
+            float32x4_t ab_re = vaddq_f32(a.val[0], b.val[0]);
+            float32x4_t ab_im = vaddq_f32(a.val[1], b.val[1]);
+            float32x4_t ab_re_1 = vsubq_f32(a.val[0], b.val[0]);
+            float32x4_t ab_im_1 = vsubq_f32(a.val[1], b.val[1]);
+            float32x4_t cd_re = vaddq_f32(c.val[0], d.val[0]);
+            float32x4_t cd_im = vaddq_f32(c.val[1], d.val[1]);
+
+            // Rotate by -i (forward) or i (inverse)
+            float32x4_t cd_re_1 = vmulq_f32(sign, vsubq_f32(c.val[1], d.val[1]));
+            float32x4_t cd_im_1 = vmulq_f32(sign, vsubq_f32(d.val[0], c.val[0]));
+
+            vst2q_f32(x0 + j, {vaddq_f32(ab_re, cd_re), vaddq_f32(ab_im, cd_im)});
+            vst2q_f32(x1 + j, {vaddq_f32(ab_re_1, cd_re_1), vaddq_f32(ab_im_1, cd_im_1)});
+            vst2q_f32(x2 + j, {vsubq_f32(ab_re, cd_re), vsubq_f32(ab_im, cd_im)});
+            vst2q_f32(x3 + j, {vsubq_f32(ab_re_1, cd_re_1), vsubq_f32(ab_im_1, cd_im_1)});
+        }
+        Scalar::radix4(signal + end, twiddles + end, stride, rem, inverse);
+    }
+
+    inline void radix4_lanes(float *signal,
+                             const float *twiddles,
+                             unsigned stride,
+                             unsigned twiddle_stride,
+                             unsigned length,
+                             bool inverse) {
+        float *x0 = signal;
+        float *x1 = x0 + stride * 2;
+        float *x2 = x1 + stride * 2;
+        float *x3 = x2 + stride * 2;
+
+        // Broadcast each twiddle factor to every complex lane
+        const float *w1 = twiddles;
+        const float *w2 = w1 + twiddle_stride * 2;
+        const float *w3 = w2 + twiddle_stride * 2;
+        float32x4x2_t v1 = {vdupq_n_f32(w1[0]), vdupq_n_f32(w1[1])};
+        float32x4x2_t v2 = {vdupq_n_f32(w2[0]), vdupq_n_f32(w2[1])};
+        float32x4x2_t v3 = {vdupq_n_f32(w3[0]), vdupq_n_f32(w3[1])};
+        float32x4_t sign = vdupq_n_f32(inverse ? -1 : 1);
+
+        unsigned rem = length % 4;
+        unsigned end = (length - rem) * 2;
+        for (unsigned j = 0; j < end; j += 8) {
+            float32x4x2_t a = vld2q_f32(x0 + j);
+            float32x4x2_t b = cmul(vld2q_f32(x1 + j), v1);
+            float32x4x2_t c = cmul(vld2q_f32(x2 + j), v2);
+            float32x4x2_t d = cmul(vld2q_f32(x3 + j), v3);
+
+            float32x4_t ab_re = vaddq_f32(a.val[0], b.val[0]);
+            float32x4_t ab_im = vaddq_f32(a.val[1], b.val[1]);
+            float32x4_t ab_re_1 = vsubq_f32(a.val[0], b.val[0]);
+            float32x4_t ab_im_1 = vsubq_f32(a.val[1], b.val[1]);
+            float32x4_t cd_re = vaddq_f32(c.val[0], d.val[0]);
+            float32x4_t cd_im = vaddq_f32(c.val[1], d.val[1]);
+
+            // Rotate by -i (forward) or i (inverse)
+            float32x4_t cd_re_1 = vmulq_f32(sign, vsubq_f32(c.val[1], d.val[1]));
+            float32x4_t cd_im_1 = vmulq_f32(sign, vsubq_f32(d.val[0], c.val[0]));
+
+            vst2q_f32(x0 + j, {vaddq_f32(ab_re, cd_re), vaddq_f32(ab_im, cd_im)});
+            vst2q_f32(x1 + j, {vaddq_f32(ab_re_1, cd_re_1), vaddq_f32(ab_im_1, cd_im_1)});
+            vst2q_f32(x2 + j, {vsubq_f32(ab_re, cd_re), vsubq_f32(ab_im, cd_im)});
+            vst2q_f32(x3 + j, {vsubq_f32(ab_re_1, cd_re_1), vsubq_f32(ab_im_1, cd_im_1)});
+        }
+        Scalar::radix4_lanes(signal + end, twiddles, stride, twiddle_stride, rem, inverse);
+    }
 } // namespace Dynamo::Vectorize::Neon
\ No newline at end of file
@@ -64,6 +64,71 @@ namespace Dynamo::Vectorize::SSE {
         Scalar::vsma(src, scalar, dst, rem);
     }
 
+    inline void vcma(const float *src_a_re,
+                     const float *src_a_im,
+                     const float *src_b_re,
+                     const float *src_b_im,
+                     float *dst_re,
+                     float *dst_im,
+                     unsigned length) {
+        unsigned rem = length % 4;
+        float *dst_end = dst_re + length - rem;
+        while (dst_re < dst_end) {
+            __m128 a_re = _mm_loadu_ps(src_a_re);
+            __m128 a_im = _mm_loadu_ps(src_a_im);
+            __m128 b_re = _mm_loadu_ps(src_b_re);
+            __m128 b_im = _mm_loadu_ps(src_b_im);
+
+            __m128 re = _mm_sub_ps(_mm_mul_ps(a_re, b_re), _mm_mul_ps(a_im, b_im));
+            __m128 im = _mm_add_ps(_mm_mul_ps(a_re, b_im), _mm_mul_ps(a_im, b_re));
+            _mm_storeu_ps(dst_re, _mm_add_ps(_mm_loadu_ps(dst_re), re));
+            _mm_storeu_ps(dst_im, _mm_add_ps(_mm_loadu_ps(dst_im), im));
+
+            src_a_re += 4;
+            src_a_im += 4;
+            src_b_re += 4;
+            src_b_im += 4;
+            dst_re += 4;
+            dst_im += 4;
+        }
+        Scalar::vcma(src_a_re, src_a_im, src_b_re, src_b_im, dst_re, dst_im, rem);
+    }
+
+    inline void i16tof(const std::int16_t *src, const float scalar, float *dst, unsigned length) {
+        __m128 scalar_v = _mm_set1_ps(scalar);
+        unsigned rem = length % 8;
+        float *dst_end = dst + length - rem;
+        while (dst < dst_end) {
+            // Sign-extend each half to 32-bit integers
+            __m128i src_v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+            __m128i lo_v = _mm_srai_epi32(_mm_unpacklo_epi16(src_v, src_v), 16);
+            __m128i hi_v = _mm_srai_epi32(_mm_unpackhi_epi16(src_v, src_v), 16);
+            _mm_storeu_ps(dst, _mm_mul_ps(_mm_cvtepi32_ps(lo_v), scalar_v));
+            _mm_storeu_ps(dst + 4, _mm_mul_ps(_mm_cvtepi32_ps(hi_v), scalar_v));
+            src += 8;
+            dst += 8;
+        }
+        Scalar::i16tof(src, scalar, dst, rem);
+    }
+
+    inline float vdot(const float *src_a, const float *src_b, unsigned length) {
+        __m128 sum_v = _mm_setzero_ps();
+        unsigned rem = length % 4;
+        const float *src_end = src_a + length - rem;
+        while (src_a < src_end) {
+            __m128 a_v = _mm_loadu_ps(src_a);
+            __m128 b_v = _mm_loadu_ps(src_b);
+            sum_v = _mm_add_ps(_mm_mul_ps(a_v, b_v), sum_v);
+            src_a += 4;
+            src_b += 4;
+        }
+
+        // Horizontal sum
+        sum_v = _mm_add_ps(sum_v, _mm_movehl_ps(sum_v, sum_v));
+        sum_v = _mm_add_ss(sum_v, _mm_shuffle_ps(sum_v, sum_v, _MM_SHUFFLE(1, 1, 1, 1)));
+        return _mm_cvtss_f32(sum_v) + Scalar::vdot(src_a, src_b, rem);
+    }
+
     inline void vclamp(const float *src, const float lo, const float hi, float *dst, unsigned length) {
         __m128 lo_v = _mm_set1_ps(lo);
         __m128 hi_v = _mm_set1_ps(hi);
@@ -78,4 +143,261 @@ namespace Dynamo::Vectorize::SSE {
         }
         Scalar::vclamp(src, lo, hi, dst, rem);
     }
+
+    inline void interleave(const float *src, float *dst, unsigned channels, unsigned length, unsigned stride) {
+        unsigned rem = length % 4;
+        unsigned end = length - rem;
+        switch (channels) {
+        case 2:
+            for (unsigned i = 0; i < end; i += 4) {
+                __m128 c0 = _mm_loadu_ps(src + i);
+                __m128 c1 = _mm_loadu_ps(src + stride + i);
+                _mm_storeu_ps(dst + 2 * i, _mm_unpacklo_ps(c0, c1));
+                _mm_storeu_ps(dst + 2 * i + 4, _mm_unpackhi_ps(c0, c1));
+            }
+            break;
+        case 4:
+            for (unsigned i = 0; i < end; i += 4) {
+                __m128 r0 = _mm_loadu_ps(src + i);
+                __m128 r1 = _mm_loadu_ps(src + stride + i);
+                __m128 r2 = _mm_loadu_ps(src + 2 * stride + i);
+                __m128 r3 = _mm_loadu_ps(src + 3 * stride + i);
+                _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+                float *frame = dst + 4 * i;
+                _mm_storeu_ps(frame, r0);
+                _mm_storeu_ps(frame + 4, r1);
+                _mm_storeu_ps(frame + 8, r2);
+                _mm_storeu_ps(frame + 12, r3);
+            }
+            break;
+        case 6:
+            for (unsigned i = 0; i < end; i += 4) {
+                __m128 r0 = _mm_loadu_ps(src + i);
+                __m128 r1 = _mm_loadu_ps(src + stride + i);
+                __m128 r2 = _mm_loadu_ps(src + 2 * stride + i);
+                __m128 r3 = _mm_loadu_ps(src + 3 * stride + i);
+                _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+                __m128 c4 = _mm_loadu_ps(src + 4 * stride + i);
+                __m128 c5 = _mm_loadu_ps(src + 5 * stride + i);
+                __m128 p_lo = _mm_unpacklo_ps(c4, c5);
+                __m128 p_hi = _mm_unpackhi_ps(c4, c5);
+
+                float *frame = dst + 6 * i;
+                _mm_storeu_ps(frame, r0);
+                _mm_storel_pi(reinterpret_cast<__m64 *>(frame + 4), p_lo);
+                _mm_storeu_ps(frame + 6, r1);
+                _mm_storeh_pi(reinterpret_cast<__m64 *>(frame + 10), p_lo);
+                _mm_storeu_ps(frame + 12, r2);
+                _mm_storel_pi(reinterpret_cast<__m64 *>(frame + 16), p_hi);
+                _mm_storeu_ps(frame + 18, r3);
+                _mm_storeh_pi(reinterpret_cast<__m64 *>(frame + 22), p_hi);
+            }
+            break;
+        case 8:
+            for (unsigned i = 0; i < end; i += 4) {
+                __m128 r0 = _mm_loadu_ps(src + i);
+                __m128 r1 = _mm_loadu_ps(src + stride + i);
+                __m128 r2 = _mm_loadu_ps(src + 2 * stride + i);
+                __m128 r3 = _mm_loadu_ps(src + 3 * stride + i);
+                _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+                __m128 s0 = _mm_loadu_ps(src + 4 * stride + i);
+                __m128 s1 = _mm_loadu_ps(src + 5 * stride + i);
+                __m128 s2 = _mm_loadu_ps(src + 6 * stride + i);
+                __m128 s3 = _mm_loadu_ps(src + 7 * stride + i);
+                _MM_TRANSPOSE4_PS(s0, s1, s2, s3);
+
+                float *frame = dst + 8 * i;
+                _mm_storeu_ps(frame, r0);
+                _mm_storeu_ps(frame + 4, s0);
+                _mm_storeu_ps(frame + 8, r1);
+                _mm_storeu_ps(frame + 12, s1);
+                _mm_storeu_ps(frame + 16, r2);
+                _mm_storeu_ps(frame + 20, s2);
+                _mm_storeu_ps(frame + 24, r3);
+                _mm_storeu_ps(frame + 28, s3);
+            }
+            break;
+        default:
+            rem = length;
+            end = 0;
+            break;
+        }
+        Scalar::interleave(src + end, dst + end * channels, channels, rem, stride);
+    }
+
+    inline void deinterleave(const float *src, float *dst, unsigned channels, unsigned length, unsigned stride) {
+        unsigned rem = length % 4;
+        unsigned end = length - rem;
+        switch (channels) {
+        case 2:
+            for (unsigned i = 0; i < end; i += 4) {
+                __m128 f01 = _mm_loadu_ps(src + 2 * i);
+                __m128 f23 = _mm_loadu_ps(src + 2 * i + 4);
+                _mm_storeu_ps(dst + i, _mm_shuffle_ps(f01, f23, _MM_SHUFFLE(2, 0, 2, 0)));
+                _mm_storeu_ps(dst + stride + i, _mm_shuffle_ps(f01, f23, _MM_SHUFFLE(3, 1, 3, 1)));
+            }
+            break;
+        case 4:
+            for (unsigned i = 0; i < end; i += 4) {
+                const float *frame = src + 4 * i;
+                __m128 r0 = _mm_loadu_ps(frame);
+                __m128 r1 = _mm_loadu_ps(frame + 4);
+                __m128 r2 = _mm_loadu_ps(frame + 8);
+                __m128 r3 = _mm_loadu_ps(frame + 12);
+                _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+                _mm_storeu_ps(dst + i, r0);
+                _mm_storeu_ps(dst + stride + i, r1);
+                _mm_storeu_ps(dst + 2 * stride + i, r2);
+                _mm_storeu_ps(dst + 3 * stride + i, r3);
+            }
+            break;
+        case 6:
+            for (unsigned i = 0; i < end; i += 4) {
+                const float *frame = src + 6 * i;
+                __m128 r0 = _mm_loadu_ps(frame);
+                __m128 r1 = _mm_loadu_ps(frame + 6);
+                __m128 r2 = _mm_loadu_ps(frame + 12);
+                __m128 r3 = _mm_loadu_ps(frame + 18);
+                _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+                __m128 p_lo = _mm_setzero_ps();
+                __m128 p_hi = _mm_setzero_ps();
+                p_lo = _mm_loadl_pi(p_lo, reinterpret_cast<const __m64 *>(frame + 4));
+                p_lo = _mm_loadh_pi(p_lo, reinterpret_cast<const __m64 *>(frame + 10));
+                p_hi = _mm_loadl_pi(p_hi, reinterpret_cast<const __m64 *>(frame + 16));
+                p_hi = _mm_loadh_pi(p_hi, reinterpret_cast<const __m64 *>(frame + 22));
+
+                _mm_storeu_ps(dst + i, r0);
+                _mm_storeu_ps(dst + stride + i, r1);
+                _mm_storeu_ps(dst + 2 * stride + i, r2);
+                _mm_storeu_ps(dst + 3 * stride + i, r3);
+                _mm_storeu_ps(dst + 4 * stride + i, _mm_shuffle_ps(p_lo, p_hi, _MM_SHUFFLE(2, 0, 2, 0)));
+                _mm_storeu_ps(dst + 5 * stride + i, _mm_shuffle_ps(p_lo, p_hi, _MM_SHUFFLE(3, 1, 3, 1)));
+            }
+            break;
+        case 8:
+            for (unsigned i = 0; i < end; i += 4) {
+                const float *frame = src + 8 * i;
+                __m128 r0 = _mm_loadu_ps(frame);
+                __m128 r1 = _mm_loadu_ps(frame + 8);
+                __m128 r2 = _mm_loadu_ps(frame + 16);
+                __m128 r3 = _mm_loadu_ps(frame + 24);
+                _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+                __m128 s0 = _mm_loadu_ps(frame + 4);
+                __m128 s1 = _mm_loadu_ps(frame + 12);
+                __m128 s2 = _mm_loadu_ps(frame + 20);
+                __m128 s3 = _mm_loadu_ps(frame + 28);
+                _MM_TRANSPOSE4_PS(s0, s1, s2, s3);
+
+                _mm_storeu_ps(dst + i, r0);
+                _mm_storeu_ps(dst + stride + i, r1);
+                _mm_storeu_ps(dst + 2 * stride + i, r2);
+                _mm_storeu_ps(dst + 3 * stride + i, r3);
+                _mm_storeu_ps(dst + 4 * stride + i, s0);
+                _mm_storeu_ps(dst + 5 * stride + i, s1);
+                _mm_storeu_ps(dst + 6 * stride + i, s2);
+                _mm_storeu_ps(dst + 7 * stride + i, s3);
+            }
+            break;
+        default:
+            rem = length;
+            end = 0;
+            break;
+        }
+        Scalar::deinterleave(src + end * channels, dst + end, channels, rem, stride);
+    }
+
+    inline __m128 cmul(__m128 a, __m128 w) {
+        // (a_re * w_re - a_im * w_im, a_im * w_re + a_re * w_im)
+        const __m128 sign = _mm_set_ps(0.0f, -0.0f, 0.0f, -0.0f);
+        __m128 w_re = _mm_shuffle_ps(w, w, _MM_SHUFFLE(2, 2, 0, 0));
+        __m128 w_im = _mm_shuffle_ps(w, w, _MM_SHUFFLE(3, 3, 1, 1));
+        __m128 a_swap = _mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1));
+        return _mm_add_ps(_mm_mul_ps(a, w_re), _mm_xor_ps(_mm_mul_ps(a_swap, w_im), sign));
+    }
+
+    inline void radix4(float *signal, const float *twiddles, unsigned stride, unsigned length, bool inverse) {
+        float *x0 = signal;
+        float *x1 = x0 + stride * 2;
+        float *x2 = x1 + stride * 2;
+        float *x3 = x2 + stride * 2;
+        const float *w1 = twiddles;
+        const float *w2 = w1 + stride * 2;
+        const float *w3 = w2 + stride * 2;
+
+        // Multiplying by -i (forward) or i (inverse) swaps the parts and
+        // negates one of them
+        __m128 rotate = inverse ? _mm_set_ps(0.0f, -0.0f, 0.0f, -0.0f) : _mm_set_ps(-0.0f, 0.0f, -0.0f, 0.0f);
+
+        unsigned rem = length % 2;
+        unsigned end = (length - rem) * 2;
+        for (unsigned j = 0; j < end; j += 4) {
+            __m128 a = _mm_loadu_ps(x0 + j);
+            __m128 b = cmul(_mm_loadu_ps(x1 + j), _mm_loadu_ps(w1 + j));
+            __m128 c = cmul(_mm_loadu_ps(x2 + j), _mm_loadu_ps(w2 + j));
+            __m128 d = cmul(_mm_loadu_ps(x3 + j), _mm_loadu_ps(w3 + j));
+
+            __m128 ab = _mm_add_ps(a, b);
+            __m128 ab_1 = _mm_sub_ps(a, b);
+            __m128 cd = _mm_add_ps(c, d);
+            __m128 cd_1 = _mm_sub_ps(c, d);
+            cd_1 = _mm_xor_ps(_mm_shuffle_ps(cd_1, cd_1, _MM_SHUFFLE(2, 3, 0, 1)), rotate);
+
+            _mm_storeu_ps(x0 + j, _mm_add_ps(ab, cd));
+            _mm_storeu_ps(x1 + j, _mm_add_ps(ab_1, cd_1));
+            _mm_storeu_ps(x2 + j, _mm_sub_ps(ab, cd));
+            _mm_storeu_ps(x3 + j, _mm_sub_ps(ab_1, cd_1));
+        }
+        Scalar::radix4(signal + end, twiddles + end, stride, rem, inverse);
+    }
+
+    inline void radix4_lanes(float *signal,
+                             const float *twiddles,
+                             unsigned stride,
+                             unsigned twiddle_stride,
+                             unsigned length,
+                             bool inverse) {
+        float *x0 = signal;
+        float *x1 = x0 + stride * 2;
+        float *x2 = x1 + stride * 2;
+        float *x3 = x2 + stride * 2;
+
+        // Broadcast each twiddle factor to every complex lane
+        const float *w1 = twiddles;
+        const float *w2 = w1 + twiddle_stride * 2;
+        const float *w3 = w2 + twiddle_stride * 2;
+        __m128 v1 = _mm_setr_ps(w1[0], w1[1], w1[0], w1[1]);
+        __m128 v2 = _mm_setr_ps(w2[0], w2[1], w2[0], w2[1]);
+        __m128 v3 = _mm_setr_ps(w3[0], w3[1], w3[0], w3[1]);
+
+        // Multiplying by -i (forward) or i (inverse) swaps the parts and
+        // negates one of them
+        __m128 rotate = inverse ? _mm_set_ps(0.0f, -0.0f, 0.0f, -0.0f) : _mm_set_ps(-0.0f, 0.0f, -0.0f, 0.0f);
+
+        unsigned rem = length % 2;
+        unsigned end = (length - rem) * 2;
+        for (unsigned j = 0; j < end; j += 4) {
+            __m128 a = _mm_loadu_ps(x0 + j);
+            __m128 b = cmul(_mm_loadu_ps(x1 + j), v1);
+            __m128 c = cmul(_mm_loadu_ps(x2 + j), v2);
+            __m128 d = cmul(_mm_loadu_ps(x3 + j), v3);
+
+            __m128 ab = _mm_add_ps(a, b);
+            __m128 ab_1 = _mm_sub_ps(a, b);
+            __m128 cd = _mm_add_ps(c, d);
+            __m128 cd_1 = _mm_sub_ps(c, d);
+            cd_1 = _mm_xor_ps(_mm_shuffle_ps(cd_1, cd_1, _MM_SHUFFLE(2, 3, 0, 1)), rotate);
+
+            _mm_storeu_ps(x0 + j, _mm_add_ps(ab, cd));
+            _mm_storeu_ps(x1 + j, _mm_add_ps(ab_1, cd_1));
+            _mm_storeu_ps(x2 + j, _mm_sub_ps(ab, cd));
+            _mm_storeu_ps(x3 + j, _mm_sub_ps(ab_1, cd_1));
+        }
+        Scalar::radix4_lanes(signal + end, twiddles, stride, twiddle_stride, rem, inverse);
+    }
 } // namespace Dynamo::Vectorize::SSE
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <algorithm>
+#include <cstdint>
 
 namespace Dynamo::Vectorize::Scalar {
     inline void smul(const float *src_a, const float scalar, float *dst, unsigned length) {
@@ -27,9 +28,149 @@ namespace Dynamo::Vectorize::Scalar {
         }
     }
 
+    inline void vcma(const float *src_a_re,
+                     const float *src_a_im,
+                     const float *src_b_re,
+                     const float *src_b_im,
+                     float *dst_re,
+                     float *dst_im,
+                     unsigned length) {
+        for (unsigned i = 0; i < length; i++) {
+            dst_re[i] += src_a_re[i] * src_b_re[i] - src_a_im[i] * src_b_im[i];
+            dst_im[i] += src_a_re[i] * src_b_im[i] + src_a_im[i] * src_b_re[i];
+        }
+    }
+
+    inline void i16tof(const std::int16_t *src, const float scalar, float *dst, unsigned length) {
+        for (unsigned i = 0; i < length; i++) {
+            dst[i] = src[i] * scalar;
+        }
+    }
+
+    inline float vdot(const float *src_a, const float *src_b, unsigned length) {
+        float sum = 0;
+        for (unsigned i = 0; i < length; i++) {
+            sum += src_a[i] * src_b[i];
+        }
+        return sum;
+    }
+
     inline void vclamp(const float *src, const float lo, const float hi, float *dst, unsigned length) {
         for (unsigned i = 0; i < length; i++) {
             dst[i] = std::clamp(src[i], lo, hi);
         }
     }
+
+    inline void interleave(const float *src, float *dst, unsigned channels, unsigned length, unsigned stride) {
+        if (channels == 1) {
+            std::copy(src, src + length, dst);
+            return;
+        }
+        for (unsigned i = 0; i < length; i++) {
+            for (unsigned c = 0; c < channels; c++) {
+                dst[i * channels + c] = src[c * stride + i];
+            }
+        }
+    }
+
+    inline void deinterleave(const float *src, float *dst, unsigned channels, unsigned length, unsigned stride) {
+        if (channels == 1) {
+            std::copy(src, src + length, dst);
+            return;
+        }
+        for (unsigned i = 0; i < length; i++) {
+            for (unsigned c = 0; c < channels; c++) {
+                dst[c * stride + i] = src[i * channels + c];
+            }
+        }
+    }
+
+    inline void radix4(float *signal, const float *twiddles, unsigned stride, unsigned length, bool inverse) {
+        float *x0 = signal;
+        float *x1 = x0 + stride * 2;
+        float *x2 = x1 + stride * 2;
+        float *x3 = x2 + stride * 2;
+        const float *w1 = twiddles;
+        const float *w2 = w1 + stride * 2;
+        const float *w3 = w2 + stride * 2;
+        float sign = inverse ? -1 : 1;
+        for (unsigned j = 0; j < length * 2; j += 2) {
+            // Twiddle the inputs
+            float b_re = x1[j] * w1[j] - x1[j + 1] * w1[j + 1];
+            float b_im = x1[j] * w1[j + 1] + x1[j + 1] * w1[j];
+            float c_re = x2[j] * w2[j] - x2[j + 1] * w2[j + 1];
+            float c_im = x2[j] * w2[j + 1] + x2[j + 1] * w2[j];
+            float d_re = x3[j] * w3[j] - x3[j + 1] * w3[j + 1];
+            float d_im = x3[j] * w3[j + 1] + x3[j + 1] * w3[j];
+
+            // First pair of radix-2 butterflies
+            float ab_re = x0[j] + b_re;
+            float ab_im = x0[j + 1] + b_im;
+            float ab_re_1 = x0[j] - b_re;
+            float ab_im_1 = x0[j + 1] - b_im;
+            float cd_re = c_re + d_re;
+            float cd_im = c_im + d_im;
+
+            // Rotate by -i (forward) or i (inverse)
+            float cd_re_1 = sign * (c_im - d_im);
+            float cd_im_1 = sign * (d_re - c_re);
+
+            // Second pair of radix-2 butterflies
+            x0[j] = ab_re + cd_re;
+            x0[j + 1] = ab_im + cd_im;
+            x1[j] = ab_re_1 + cd_re_1;
+            x1[j + 1] = ab_im_1 + cd_im_1;
+            x2[j] = ab_re - cd_re;
+            x2[j + 1] = ab_im - cd_im;
+            x3[j] = ab_re_1 - cd_re_1;
+            x3[j + 1] = ab_im_1 - cd_im_1;
+        }
+    }
+
+    inline void radix4_lanes(float *signal,
+                             const float *twiddles,
+                             unsigned stride,
+                             unsigned twiddle_stride,
+                             unsigned length,
+                             bool inverse) {
+        float *x0 = signal;
+        float *x1 = x0 + stride * 2;
+        float *x2 = x1 + stride * 2;
+        float *x3 = x2 + stride * 2;
+        const float *w1 = twiddles;
+        const float *w2 = w1 + twiddle_stride * 2;
+        const float *w3 = w2 + twiddle_stride * 2;
+        float sign = inverse ? -1 : 1;
+        for (unsigned j = 0; j < length * 2; j += 2) {
+            // Twiddle the inputs
+            float b_re = x1[j] * w1[0] - x1[j + 1] * w1[1];
+            float b_im = x1[j] * w1[1] + x1[j + 1] * w1[0];
+            float c_re = x2[j] * w2[0] - x2[j + 1] * w2[1];
+            float c_im = x2[j] * w2[1] + x2[j + 1] * w2[0];
+            float d_re = x3[j] * w3[0] - x3[j + 1] * w3[1];
+            float d_im = x3[j] * w3[1] + x3[j + 1] * w3[0];
+
+            // First pair of radix-2 butterflies
+            float ab_re = x0[j] + b_re;
+            float ab_im = x0[j + 1] + b_im;
+            float ab_re_1 = x0[j] - b_re;
+            float ab_im_1 = x0[j + 1] - b_im;
+            float cd_re = c_re + d_re;
+            float cd_im = c_im + d_im;
+
+            // Rotate by -i (forward) or i (inverse)
+            float cd_re_1 = sign * (c_im - d_im);
+            float cd_im_1 = sign * (d_re - c_re);
+
+            // Second pair of radix-2 butterflies
+            x0[j] = ab_re + cd_re;
+            x0[j + 1] = ab_im + cd_im;
+            x1[j] = ab_re_1 + cd_re_1;
+            x1[j + 1] = ab_im_1 + cd_im_1;
+            x2[j] = ab_re - cd_re;
+            x2[j + 1] = ab_im - cd_im;
+            x3[j] = ab_re_1 - cd_re_1;
+            x3[j + 1] = ab_im_1 - cd_im_1;
+        }
+    }
 } // namespace Dynamo::Vectorize::Scalar
\ No newline at end of file
@@ -1,85 +1,499 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <unordered_map>
+
 #include <Math/Fourier.hpp>
+#include <Math/Vectorize.hpp>
 #include <Utils/Bits.hpp>
 #include <Utils/Log.hpp>
 
 namespace Dynamo::Fourier {
-    void transform(Complex *signal, unsigned N) {
-        DYN_ASSERT((N & (N - 1)) == 0);
-
-        // Bit reversal element reordering
-        for (unsigned i = 1, j = 0; i < N; i++) {
-            unsigned bit = N >> 1;
-            while (bit & j) {
-                j ^= bit;
-                bit >>= 1;
-            }
-            j ^= bit;
-            if (i < j) {
-                std::swap(signal[i], signal[j]);
-            }
-        }
-
-        // Radix-2 FFT
-        for (unsigned s = 1; s <= find_lsb(N); s++) {
-            unsigned m = 1 << s;
-            unsigned half_m = m >> 1;
-            Complex omega_m = TWIDDLE_TABLE_FFT[s];
-
-            for (unsigned k = 0; k < N; k += m) {
-                Complex omega(1);
-                for (unsigned j = 0; j < half_m; j++) {
-                    unsigned u_i = k + j;
-                    unsigned t_i = u_i + half_m;
-                    Complex t = omega * signal[t_i];
-                    Complex u = signal[u_i];
-                    signal[u_i] = u + t;
-                    signal[t_i] = u - t;
-                    omega *= omega_m;
+    Plan::Plan(unsigned N) : _N(N) {
+        DYN_ASSERT(N > 0);
+
+        // Factor into radix-4 stages, with a leading radix-2 stage if there
+        // is an odd power of 2, followed by radix-3 and radix-5 stages
+        unsigned remainder = N;
+        unsigned twos = 0;
+        while ((remainder & 1) == 0) {
+            remainder >>= 1;
+            twos++;
+        }
+        if (twos & 1) {
+            _radices.push_back(2);
+        }
+        _radices.insert(_radices.end(), twos >> 1, 4);
+        for (unsigned radix : {3, 5}) {
+            while (remainder % radix == 0) {
+                remainder /= radix;
+                _radices.push_back(radix);
+            }
+        }
+
+        if (remainder == 1) {
+            // Digit reversal element reordering, where radix-4 stages are
+            // two binary digits
+            std::vector<unsigned> digits;
+            for (unsigned radix : _radices) {
+                if (radix == 4) {
+                    digits.insert(digits.end(), 2, 2);
+                } else {
+                    digits.push_back(radix);
+                }
+            }
+            std::vector<unsigned> strides(digits.size());
+            for (unsigned s = 0, L = 1; s < digits.size(); L *= digits[s++]) {
+                strides[s] = L;
+            }
+            std::vector<unsigned> order(_N);
+            for (unsigned i = 0; i < _N; i++) {
+                unsigned n = i;
+                for (unsigned s = digits.size(); s > 0; s--) {
+                    order[i] += (n % digits[s - 1]) * strides[s - 1];
+                    n /= digits[s - 1];
+                }
+            }
+
+            // Decompose the permutation into swaps along each cycle
+            std::vector<bool> visited(_N, false);
+            for (unsigned i = 0; i < _N; i++) {
+                for (unsigned j = order[i]; !visited[i] && j != i; j = order[j]) {
+                    _swaps.push_back(i);
+                    _swaps.push_back(j);
+                    visited[j] = true;
+                }
+                visited[i] = true;
+            }
+
+            // Twiddle factors of the sub-transforms of each stage, computed
+            // directly to avoid accumulating error
+            unsigned L = 1;
+            for (unsigned radix : _radices) {
+                std::vector<unsigned> order(radix - 1);
+                if (radix == 4) {
+                    order = {2, 1, 3};
+                } else {
+                    std::iota(order.begin(), order.end(), 1);
                 }
+                for (unsigned t : order) {
+                    for (unsigned j = 0; j < L; j++) {
+                        double angle = -2 * M_PI * t * j / (static_cast<double>(radix) * L);
+                        _twiddles_fft.emplace_back(std::cos(angle), std::sin(angle));
+                    }
+                }
+                L *= radix;
+            }
+            for (const Complex &w : _twiddles_fft) {
+                _twiddles_ifft.push_back(w.conjugate());
+            }
+        } else {
+            // Bluestein's algorithm computes the transform as a convolution
+            // with a chirp, using a power-of-2 transform
+            _radices.clear();
+            unsigned M = round_pow2(2 * _N - 1);
+            _bluestein = std::make_unique<Plan>(M);
+
+            // Reduce n^2 modulo 2N to keep the angles accurate
+            for (unsigned n = 0; n < _N; n++) {
+                unsigned long long n2 = (static_cast<unsigned long long>(n) * n) % (2ull * _N);
+                double angle = -M_PI * n2 / _N;
+                _chirp.emplace_back(std::cos(angle), std::sin(angle));
+            }
+
+            // Transform the conjugate chirp filter, folding in the
+            // normalization of the inverse transform
+            _chirp_spectrum.assign(M, Complex(0, 0));
+            _chirp_spectrum[0] = _chirp[0].conjugate();
+            for (unsigned n = 1; n < _N; n++) {
+                _chirp_spectrum[n] = _chirp[n].conjugate();
+                _chirp_spectrum[M - n] = _chirp[n].conjugate();
             }
+            _bluestein->transform(_chirp_spectrum.data());
+            float *data = reinterpret_cast<float *>(_chirp_spectrum.data());
+            Vectorize::smul(data, 1.0 / M, data, M * 2);
+        }
+
+        // Twiddle factors for real transforms of length 2N
+        for (unsigned k = 0; k <= (_N >> 1); k++) {
+            double angle = -M_PI * k / _N;
+            _twiddles_real.emplace_back(std::cos(angle), std::sin(angle));
         }
     }
 
-    void inverse(Complex *signal, unsigned N) {
-        DYN_ASSERT((N & (N - 1)) == 0);
-
-        // Bit reversal element reordering
-        for (unsigned i = 1, j = 0; i < N; i++) {
-            unsigned bit = N >> 1;
-            while (bit & j) {
-                j ^= bit;
-                bit >>= 1;
-            }
-            j ^= bit;
-            if (i < j) {
-                std::swap(signal[i], signal[j]);
-            }
-        }
-
-        // Radix-2 IFFT
-        for (unsigned s = 1; s <= find_lsb(N); s++) {
-            unsigned m = 1 << s;
-            unsigned half_m = m >> 1;
-            Complex omega_m = TWIDDLE_TABLE_IFFT[s];
-
-            for (unsigned k = 0; k < N; k += m) {
-                Complex omega(1);
-                for (unsigned j = 0; j < half_m; j++) {
-                    unsigned u_i = k + j;
-                    unsigned t_i = u_i + half_m;
-                    Complex t = omega * signal[t_i];
-                    Complex u = signal[u_i];
-                    signal[u_i] = u + t;
-                    signal[t_i] = u - t;
-                    omega *= omega_m;
+    void Plan::radix3(Complex *signal,
+                      const Complex *twiddles,
+                      unsigned L,
+                      unsigned stride,
+                      unsigned lanes,
+                      bool inverse) const {
+        float s = (inverse ? 1 : -1) * 0.86602540378f;
+        unsigned step = L * stride;
+        for (unsigned k = 0; k < _N; k += L * 3) {
+            for (unsigned j = 0; j < L; j++) {
+                Complex w1 = twiddles[j];
+                Complex w2 = twiddles[L + j];
+                Complex *x = signal + (k + j) * stride;
+                for (unsigned i = 0; i < lanes; i++) {
+                    Complex a = x[i];
+                    Complex b = x[step + i] * w1;
+                    Complex c = x[step * 2 + i] * w2;
+
+                    Complex sum = b + c;
+                    Complex diff = b - c;
+                    Complex t = a - sum * 0.5f;
+                    Complex u(-s * diff.im, s * diff.re);
+
+                    x[i] = a + sum;
+                    x[step + i] = t + u;
+                    x[step * 2 + i] = t - u;
                 }
             }
         }
+    }
+
+    void Plan::radix5(Complex *signal,
+                      const Complex *twiddles,
+                      unsigned L,
+                      unsigned stride,
+                      unsigned lanes,
+                      bool inverse) const {
+        float sign = inverse ? 1 : -1;
+        float c1 = 0.30901699437f;
+        float c2 = -0.80901699437f;
+        float s1 = sign * 0.95105651630f;
+        float s2 = sign * 0.58778525229f;
+        unsigned step = L * stride;
+        for (unsigned k = 0; k < _N; k += L * 5) {
+            for (unsigned j = 0; j < L; j++) {
+                Complex w1 = twiddles[j];
+                Complex w2 = twiddles[L + j];
+                Complex w3 = twiddles[L * 2 + j];
+                Complex w4 = twiddles[L * 3 + j];
+                Complex *x = signal + (k + j) * stride;
+                for (unsigned i = 0; i < lanes; i++) {
+                    Complex a = x[i];
+                    Complex b = x[step + i] * w1;
+                    Complex c = x[step * 2 + i] * w2;
+                    Complex d = x[step * 3 + i] * w3;
+                    Complex e = x[step * 4 + i] * w4;
+
+                    Complex sum14 = b + e;
+                    Complex diff14 = b - e;
+                    Complex sum23 = c + d;
+                    Complex diff23 = c - d;
+
+                    Complex t1 = a + sum14 * c1 + sum23 * c2;
+                    Complex t2 = a + sum14 * c2 + sum23 * c1;
+                    Complex v1 = diff14 * s1 + diff23 * s2;
+                    Complex v2 = diff14 * s2 - diff23 * s1;
+                    Complex u1(-v1.im, v1.re);
+                    Complex u2(-v2.im, v2.re);
+
+                    x[i] = a + sum14 + sum23;
+                    x[step + i] = t1 + u1;
+                    x[step * 2 + i] = t2 + u2;
+                    x[step * 3 + i] = t2 - u2;
+                    x[step * 4 + i] = t1 - u1;
+                }
+            }
+        }
+    }
+
+    void Plan::execute(Complex *signal,
+                       unsigned stride,
+                       unsigned lanes,
+                       const std::vector<Complex> &twiddles,
+                       bool inverse) const {
+        // Digit reversal element reordering
+        for (unsigned i = 0; i < _swaps.size(); i += 2) {
+            Complex *a = signal + _swaps[i] * stride;
+            Complex *b = signal + _swaps[i + 1] * stride;
+            std::swap_ranges(a, a + lanes, b);
+        }
+
+        float *data = reinterpret_cast<float *>(signal);
+        const Complex *stage_twiddles = twiddles.data();
+        unsigned L = 1;
+        for (unsigned radix : _radices) {
+            if (radix == 2) {
+                // Only ever the first stage, which has no twiddle factors
+                for (unsigned k = 0; k < _N; k += 2) {
+                    Complex *x = signal + k * stride;
+                    for (unsigned i = 0; i < lanes; i++) {
+                        Complex u = x[i];
+                        Complex t = x[stride + i];
+                        x[i] = u + t;
+                        x[stride + i] = u - t;
+                    }
+                }
+            } else if (radix == 4 && stride > 1) {
+                // Vectorize across signals, sharing the twiddle factors
+                const float *w = reinterpret_cast<const float *>(stage_twiddles);
+                for (unsigned k = 0; k < _N; k += L * 4) {
+                    for (unsigned j = 0; j < L; j++) {
+                        Vectorize::radix4_lanes(data + (k + j) * stride * 2, w + j * 2, L * stride, L, lanes, inverse);
+                    }
+                }
+            } else if (radix == 4 && L == 1) {
+                float sign = inverse ? -1 : 1;
+                for (unsigned k = 0; k < _N; k += 4) {
+                    Complex ab = signal[k] + signal[k + 1];
+                    Complex ab_1 = signal[k] - signal[k + 1];
+                    Complex cd = signal[k + 2] + signal[k + 3];
+                    Complex cd_1 = signal[k + 2] - signal[k + 3];
+                    cd_1 = Complex(sign * cd_1.im, -sign * cd_1.re);
+
+                    signal[k] = ab + cd;
+                    signal[k + 1] = ab_1 + cd_1;
+                    signal[k + 2] = ab - cd;
+                    signal[k + 3] = ab_1 - cd_1;
+                }
+            } else if (radix == 4) {
+                // Vectorize across the butterflies of a single signal
+                const float *w = reinterpret_cast<const float *>(stage_twiddles);
+                for (unsigned k = 0; k < _N; k += L * 4) {
+                    Vectorize::radix4(data + k * 2, w, L, L, inverse);
+                }
+            } else if (radix == 3) {
+                radix3(signal, stage_twiddles, L, stride, lanes, inverse);
+            } else {
+                radix5(signal, stage_twiddles, L, stride, lanes, inverse);
+            }
+            stage_twiddles += (radix - 1) * L;
+            L *= radix;
+        }
+    }
+
+    void Plan::execute_bluestein(Complex *signal, unsigned stride, unsigned lanes, Complex *scratch) const {
+        unsigned M = _bluestein->size();
+
+        // Modulate by the chirp and zero-pad
+        for (unsigned n = 0; n < _N; n++) {
+            const Complex *x = signal + n * stride;
+            Complex *y = scratch + n * lanes;
+            for (unsigned i = 0; i < lanes; i++) {
+                y[i] = x[i] * _chirp[n];
+            }
+        }
+        std::fill(scratch + _N * lanes, scratch + M * lanes, Complex(0, 0));
+
+        // Convolve with the conjugate chirp
+        _bluestein->execute(scratch, lanes, lanes, _bluestein->_twiddles_fft, false);
+        for (unsigned m = 0; m < M; m++) {
+            Complex *y = scratch + m * lanes;
+            for (unsigned i = 0; i < lanes; i++) {
+                y[i] *= _chirp_spectrum[m];
+            }
+        }
+        _bluestein->execute(scratch, lanes, lanes, _bluestein->_twiddles_ifft, true);
+
+        // Demodulate
+        for (unsigned k = 0; k < _N; k++) {
+            Complex *x = signal + k * stride;
+            const Complex *y = scratch + k * lanes;
+            for (unsigned i = 0; i < lanes; i++) {
+                x[i] = y[i] * _chirp[k];
+            }
+        }
+    }
+
+    unsigned Plan::size() const { return _N; }
+
+    unsigned Plan::scratch_size() const { return _bluestein ? _bluestein->size() : 0; }
+
+    const std::vector<Complex> &Plan::real_twiddles() const { return _twiddles_real; }
+
+    void Plan::transform(Complex *signal, Complex *scratch) const { transform_batch(signal, 1, 1, scratch); }
+
+    void Plan::inverse(Complex *signal, Complex *scratch) const { inverse_batch(signal, 1, 1, scratch); }
+
+    void Plan::transform_batch(Complex *signals, unsigned count, unsigned stride, Complex *scratch) const {
+        DYN_ASSERT(count <= stride);
+        if (_bluestein) {
+            DYN_ASSERT(scratch != nullptr);
+            execute_bluestein(signals, stride, count, scratch);
+        } else {
+            execute(signals, stride, count, _twiddles_fft, false);
+        }
+    }
+
+    void Plan::inverse_batch(Complex *signals, unsigned count, unsigned stride, Complex *scratch) const {
+        DYN_ASSERT(count <= stride);
+        if (_bluestein) {
+            // Inverse transform by conjugating the forward transform
+            DYN_ASSERT(scratch != nullptr);
+            for (unsigned n = 0; n < _N; n++) {
+                Complex *x = signals + n * stride;
+                for (unsigned i = 0; i < count; i++) {
+                    x[i] = x[i].conjugate();
+                }
+            }
+            execute_bluestein(signals, stride, count, scratch);
+            for (unsigned n = 0; n < _N; n++) {
+                Complex *x = signals + n * stride;
+                for (unsigned i = 0; i < count; i++) {
+                    x[i] = x[i].conjugate();
+                }
+            }
+        } else {
+            execute(signals, stride, count, _twiddles_ifft, true);
+        }
 
         // Normalize
-        float inv_N = 1.0 / N;
-        for (unsigned f = 0; f < N; f++) {
-            signal[f] *= inv_N;
+        float *data = reinterpret_cast<float *>(signals);
+        if (count == stride) {
+            Vectorize::smul(data, 1.0 / _N, data, _N * count * 2);
+        } else {
+            for (unsigned n = 0; n < _N; n++) {
+                float *x = data + n * stride * 2;
+                Vectorize::smul(x, 1.0 / _N, x, count * 2);
+            }
+        }
+    }
+
+    const Plan &get_plan(unsigned N) {
+        DYN_ASSERT(N > 0);
+
+        // Power-of-2 plans are looked up without locking
+        if ((N & (N - 1)) == 0) {
+            static std::array<std::unique_ptr<Plan>, 32> plans;
+            static std::array<std::once_flag, 32> flags;
+
+            unsigned i = find_lsb(N);
+            std::call_once(flags[i], [&]() { plans[i] = std::make_unique<Plan>(N); });
+            return *plans[i];
+        }
+
+        static std::unordered_map<unsigned, std::unique_ptr<Plan>> plans;
+        static std::mutex mutex;
+
+        std::lock_guard<std::mutex> lock(mutex);
+        std::unique_ptr<Plan> &plan = plans[N];
+        if (!plan) {
+            plan = std::make_unique<Plan>(N);
+        }
+        return *plan;
+    }
+
+    /**
+     * @brief Get the workspace of the calling thread for executing a plan.
+     *
+     * @param size Number of workspace values.
+     * @return Complex*
+     */
+    static Complex *get_scratch(unsigned size) {
+        thread_local std::vector<Complex> scratch;
+        if (scratch.size() < size) {
+            scratch.resize(size);
+        }
+        return scratch.data();
+    }
+
+    void transform(Complex *signal, unsigned N) {
+        const Plan &plan = get_plan(N);
+        plan.transform(signal, get_scratch(plan.scratch_size()));
+    }
+
+    void inverse(Complex *signal, unsigned N) {
+        const Plan &plan = get_plan(N);
+        plan.inverse(signal, get_scratch(plan.scratch_size()));
+    }
+
+    void transform_batch(Complex *signals, unsigned N, unsigned K, ThreadPool *pool) {
+        const Plan &plan = get_plan(N);
+        if (!pool) {
+            plan.transform_batch(signals, K, K, get_scratch(plan.scratch_size() * K));
+            return;
+        }
+
+        // Split the signals into groups of lanes for each worker
+        std::vector<std::future<void>> jobs;
+        for (unsigned k = 0; k < K; k += BATCH_LANES) {
+            unsigned count = std::min(BATCH_LANES, K - k);
+            jobs.push_back(pool->submit([&plan, signals, k, count, K]() {
+                plan.transform_batch(signals + k, count, K, get_scratch(plan.scratch_size() * count));
+            }));
+        }
+        for (std::future<void> &job : jobs) {
+            job.wait();
+        }
+    }
+
+    void inverse_batch(Complex *signals, unsigned N, unsigned K, ThreadPool *pool) {
+        const Plan &plan = get_plan(N);
+        if (!pool) {
+            plan.inverse_batch(signals, K, K, get_scratch(plan.scratch_size() * K));
+            return;
+        }
+
+        // Split the signals into groups of lanes for each worker
+        std::vector<std::future<void>> jobs;
+        for (unsigned k = 0; k < K; k += BATCH_LANES) {
+            unsigned count = std::min(BATCH_LANES, K - k);
+            jobs.push_back(pool->submit([&plan, signals, k, count, K]() {
+                plan.inverse_batch(signals + k, count, K, get_scratch(plan.scratch_size() * count));
+            }));
+        }
+        for (std::future<void> &job : jobs) {
+            job.wait();
         }
     }
+
+    void transform_real(const float *signal, Complex *spectrum, unsigned N) {
+        DYN_ASSERT(N >= 2 && (N & 1) == 0);
+        unsigned M = N >> 1;
+        const Plan &plan = get_plan(M);
+
+        // Pack even and odd samples as the real and imaginary parts of a
+        // half-length complex signal
+        std::copy(signal, signal + N, reinterpret_cast<float *>(spectrum));
+        plan.transform(spectrum, get_scratch(plan.scratch_size()));
+
+        // Split the spectrum of the packed signal
+        Complex z0 = spectrum[0];
+        spectrum[0] = Complex(z0.re + z0.im, 0);
+        spectrum[M] = Complex(z0.re - z0.im, 0);
+
+        const std::vector<Complex> &twiddles = plan.real_twiddles();
+        for (unsigned k = 1; k <= (M >> 1); k++) {
+            Complex a = spectrum[k];
+            Complex b = spectrum[M - k].conjugate();
+            Complex even = (a + b) * 0.5;
+            Complex odd = twiddles[k] * ((a - b) * Complex(0, -0.5));
+
+            spectrum[k] = even + odd;
+            spectrum[M - k] = (even - odd).conjugate();
+        }
+    }
+
+    void inverse_real(Complex *spectrum, float *signal, unsigned N) {
+        DYN_ASSERT(N >= 2 && (N & 1) == 0);
+        unsigned M = N >> 1;
+        const Plan &plan = get_plan(M);
+
+        // Merge the spectrum into that of the packed signal
+        float x0 = spectrum[0].re;
+        float xm = spectrum[M].re;
+        spectrum[0] = Complex((x0 + xm) * 0.5, (x0 - xm) * 0.5);
+
+        const std::vector<Complex> &twiddles = plan.real_twiddles();
+        for (unsigned k = 1; k <= (M >> 1); k++) {
+            Complex a = spectrum[k];
+            Complex b = spectrum[M - k].conjugate();
+            Complex even = (a + b) * 0.5;
+            Complex odd = twiddles[k].conjugate() * ((a - b) * Complex(0, 0.5));
+
+            spectrum[k] = even + odd;
+            spectrum[M - k] = (even - odd).conjugate();
+        }
+
+        // Unpack the even and odd samples
+        plan.inverse(spectrum, get_scratch(plan.scratch_size()));
+        const float *packed = reinterpret_cast<const float *>(spectrum);
+        std::copy(packed, packed + N, signal);
+    }
 } // namespace Dynamo::Fourier
\ No newline at end of file
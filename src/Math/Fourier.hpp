@@ -1,43 +1,226 @@
 #pragma once
 
-#include <array>
+#include <memory>
+#include <vector>
 
 #include <Math/Complex.hpp>
+#include <Utils/ThreadPool.hpp>
 
 namespace Dynamo::Fourier {
     /**
-     * @brief Pre-compute the twiddle factor tables.
+     * @brief Number of signals per job when splitting a batch across a thread
+     * pool.
      *
-     * @param inverse Forward or inverse transform table.
-     * @return std::array<Complex, 32>
      */
-    static std::array<Complex, 32> construct_twiddle_table(bool inverse) {
-        std::array<Complex, 32> table;
-        float sign = inverse ? 1 : -1;
-        for (unsigned i = 0; i < 32; i++) {
-            table[i] = Complex(0, sign * 2 * M_PI / (1 << i)).exp();
-        }
-        return table;
-    }
+    static constexpr unsigned BATCH_LANES = 64;
 
     /**
-     * @brief Pre-compute twiddle factors for the forward fourier transform.
+     * @brief Pre-computed tables for the fourier transform of a fixed length.
+     *
+     * Lengths of the form 2^a 3^b 5^c are decomposed into radix-2, radix-4,
+     * radix-3 and radix-5 stages. Other lengths use Bluestein's algorithm,
+     * which requires scratch_size() values of workspace.
+     *
+     * Executing a plan does not allocate.
      *
      */
-    static const std::array<Complex, 32> TWIDDLE_TABLE_FFT = construct_twiddle_table(false);
+    class Plan {
+        unsigned _N;
+
+        /**
+         * @brief Radix of each stage in execution order.
+         *
+         */
+        std::vector<unsigned> _radices;
+
+        /**
+         * @brief Pairs of indices swapped by the digit reversal reordering.
+         *
+         */
+        std::vector<unsigned> _swaps;
+
+        /**
+         * @brief Twiddle factors of each stage.
+         *
+         */
+        std::vector<Complex> _twiddles_fft;
+        std::vector<Complex> _twiddles_ifft;
+
+        /**
+         * @brief Twiddle factors for splitting the spectrum of a real signal
+         * of length 2N.
+         *
+         */
+        std::vector<Complex> _twiddles_real;
+
+        /**
+         * @brief Power-of-2 plan for Bluestein's algorithm.
+         *
+         */
+        std::unique_ptr<Plan> _bluestein;
+
+        /**
+         * @brief Chirp sequence for Bluestein's algorithm.
+         *
+         */
+        std::vector<Complex> _chirp;
+
+        /**
+         * @brief Transform of the conjugate chirp filter for Bluestein's
+         * algorithm.
+         *
+         */
+        std::vector<Complex> _chirp_spectrum;
+
+        /**
+         * @brief Run the reordering and each stage.
+         *
+         * @param signal   Signal buffer.
+         * @param stride   Distance between consecutive values of a signal.
+         * @param lanes    Number of interleaved signals.
+         * @param twiddles Twiddle factor table.
+         * @param inverse  Forward or inverse transform.
+         */
+        void execute(Complex *signal,
+                     unsigned stride,
+                     unsigned lanes,
+                     const std::vector<Complex> &twiddles,
+                     bool inverse) const;
+
+        /**
+         * @brief Run the forward transform with Bluestein's algorithm.
+         *
+         * @param signal  Signal buffer.
+         * @param stride  Distance between consecutive values of a signal.
+         * @param lanes   Number of interleaved signals.
+         * @param scratch Workspace of scratch_size() * lanes values.
+         */
+        void execute_bluestein(Complex *signal, unsigned stride, unsigned lanes, Complex *scratch) const;
+
+        /**
+         * @brief Radix-3 butterflies of a stage.
+         *
+         * @param signal   Signal buffer.
+         * @param twiddles Twiddle factors of the stage.
+         * @param L        Length of the sub-transforms.
+         * @param stride   Distance between consecutive values of a signal.
+         * @param lanes    Number of interleaved signals.
+         * @param inverse  Forward or inverse transform.
+         */
+        void radix3(Complex *signal,
+                    const Complex *twiddles,
+                    unsigned L,
+                    unsigned stride,
+                    unsigned lanes,
+                    bool inverse) const;
+
+        /**
+         * @brief Radix-5 butterflies of a stage.
+         *
+         * @param signal   Signal buffer.
+         * @param twiddles Twiddle factors of the stage.
+         * @param L        Length of the sub-transforms.
+         * @param stride   Distance between consecutive values of a signal.
+         * @param lanes    Number of interleaved signals.
+         * @param inverse  Forward or inverse transform.
+         */
+        void radix5(Complex *signal,
+                    const Complex *twiddles,
+                    unsigned L,
+                    unsigned stride,
+                    unsigned lanes,
+                    bool inverse) const;
+
+      public:
+        /**
+         * @brief Construct a new Plan object.
+         *
+         * @param N Total number of frames.
+         */
+        Plan(unsigned N);
+
+        /**
+         * @brief Get the length of the transform.
+         *
+         * @return unsigned
+         */
+        unsigned size() const;
+
+        /**
+         * @brief Get the number of workspace values needed to execute the
+         * plan.
+         *
+         * @return unsigned
+         */
+        unsigned scratch_size() const;
+
+        /**
+         * @brief Get the twiddle factors W_2N^k for 0 <= k <= N / 2, used to
+         * split the spectrum of a real signal of length 2N.
+         *
+         * @return const std::vector<Complex>&
+         */
+        const std::vector<Complex> &real_twiddles() const;
+
+        /**
+         * @brief Fourier transform in-place.
+         *
+         * @param signal  Signal buffer.
+         * @param scratch Workspace of scratch_size() values, can be null if
+         * this is 0.
+         */
+        void transform(Complex *signal, Complex *scratch = nullptr) const;
+
+        /**
+         * @brief Inverse fourier transform in-place.
+         *
+         * @param signal  Signal buffer.
+         * @param scratch Workspace of scratch_size() values, can be null if
+         * this is 0.
+         */
+        void inverse(Complex *signal, Complex *scratch = nullptr) const;
+
+        /**
+         * @brief Fourier transform of a batch of signals in-place.
+         *
+         * The signals are interleaved so that SIMD lanes span signals, with
+         * the n-th value of the k-th signal at signals[n * stride + k].
+         *
+         * @param signals Batch buffer.
+         * @param count   Number of signals.
+         * @param stride  Distance between consecutive values of a signal.
+         * @param scratch Workspace of scratch_size() * count values, can be
+         * null if scratch_size() is 0.
+         */
+        void transform_batch(Complex *signals, unsigned count, unsigned stride, Complex *scratch = nullptr) const;
+
+        /**
+         * @brief Inverse fourier transform of a batch of signals in-place.
+         *
+         * @param signals Batch buffer, interleaved as in transform_batch().
+         * @param count   Number of signals.
+         * @param stride  Distance between consecutive values of a signal.
+         * @param scratch Workspace of scratch_size() * count values, can be
+         * null if scratch_size() is 0.
+         */
+        void inverse_batch(Complex *signals, unsigned count, unsigned stride, Complex *scratch = nullptr) const;
+    };
 
     /**
-     * @brief Pre-compute twiddle factors for the inverse fourier transform.
+     * @brief Get the cached plan for a transform length, building it on first
+     * use.
      *
+     * @param N Total number of frames.
+     * @return const Plan&
      */
-    static const std::array<Complex, 32> TWIDDLE_TABLE_IFFT = construct_twiddle_table(true);
+    const Plan &get_plan(unsigned N);
 
     /**
      * @brief Implementation of the fourier transform algorithm to extract
      * the frequency-domain of a time-domain signal in-place.
      *
      * @param signal Signal buffer.
-     * @param N      Total number of frames (must be a power of 2).
+     * @param N      Total number of frames.
      */
     void transform(Complex *signal, unsigned N);
 
@@ -46,7 +229,51 @@ namespace Dynamo::Fourier {
      * extract the time-domain of a frequency-domain signal in-place.
      *
      * @param signal Signal buffer.
-     * @param N      Total number of frames (must be a power of 2).
+     * @param N      Total number of frames.
      */
     void inverse(Complex *signal, unsigned N);
+
+    /**
+     * @brief Fourier transform of K interleaved signals in-place, where the
+     * n-th value of the k-th signal is at signals[n * K + k].
+     *
+     * @param signals Batch buffer of N * K values.
+     * @param N       Total number of frames of each signal.
+     * @param K       Number of signals.
+     * @param pool    Optional thread pool to split the batch across.
+     */
+    void transform_batch(Complex *signals, unsigned N, unsigned K, ThreadPool *pool = nullptr);
+
+    /**
+     * @brief Inverse fourier transform of K interleaved signals in-place.
+     *
+     * @param signals Batch buffer of N * K values.
+     * @param N       Total number of frames of each signal.
+     * @param K       Number of signals.
+     * @param pool    Optional thread pool to split the batch across.
+     */
+    void inverse_batch(Complex *signals, unsigned N, unsigned K, ThreadPool *pool = nullptr);
+
+    /**
+     * @brief Fourier transform of a real-valued time-domain signal.
+     *
+     * The signal is packed into a complex signal of half the length, so this
+     * only computes the N / 2 + 1 non-redundant frequency bins.
+     *
+     * @param signal   Real signal buffer of N frames.
+     * @param spectrum Destination buffer of N / 2 + 1 frequency bins.
+     * @param N        Total number of frames (must be even).
+     */
+    void transform_real(const float *signal, Complex *spectrum, unsigned N);
+
+    /**
+     * @brief Inverse fourier transform of the N / 2 + 1 frequency bins of a
+     * real-valued time-domain signal.
+     *
+     * @param spectrum Source buffer of N / 2 + 1 frequency bins, this is
+     * overwritten.
+     * @param signal   Destination real signal buffer of N frames.
+     * @param N        Total number of frames (must be even).
+     */
+    void inverse_real(Complex *spectrum, float *signal, unsigned N);
 } // namespace Dynamo::Fourier
\ No newline at end of file
@@ -74,6 +74,52 @@ namespace Dynamo::Vectorize {
         arch::vsma(src, scalar, dst, length);
     }
 
+    /**
+     * @brief dst[i] += src_a[i] * src_b[i] for complex numbers in split
+     * real and imaginary arrays
+     *
+     * @param src_a_re
+     * @param src_a_im
+     * @param src_b_re
+     * @param src_b_im
+     * @param dst_re
+     * @param dst_im
+     * @param length
+     */
+    inline void vcma(const float *src_a_re,
+                     const float *src_a_im,
+                     const float *src_b_re,
+                     const float *src_b_im,
+                     float *dst_re,
+                     float *dst_im,
+                     unsigned length) {
+        arch::vcma(src_a_re, src_a_im, src_b_re, src_b_im, dst_re, dst_im, length);
+    }
+
+    /**
+     * @brief dst[i] = src[i] * scalar, converting 16-bit integers to floats
+     *
+     * @param src
+     * @param scalar
+     * @param dst
+     * @param length
+     */
+    inline void i16tof(const std::int16_t *src, const float scalar, float *dst, unsigned length) {
+        arch::i16tof(src, scalar, dst, length);
+    }
+
+    /**
+     * @brief Sum of src_a[i] * src_b[i]
+     *
+     * @param src_a
+     * @param src_b
+     * @param length
+     * @return float
+     */
+    inline float vdot(const float *src_a, const float *src_b, unsigned length) {
+        return arch::vdot(src_a, src_b, length);
+    }
+
     /**
      * @brief dst[i] = min(hi, max(lo, src[i]))
      *
@@ -86,4 +132,85 @@ namespace Dynamo::Vectorize {
     inline void vclamp(const float *src, const float lo, const float hi, float *dst, unsigned length) {
         arch::vclamp(src, lo, hi, dst, length);
     }
+
+    /**
+     * @brief dst[i * channels + c] = src[c * length + i]
+     *
+     * Vectorized for 1, 2, 4, 6 and 8 channels.
+     *
+     * @param src      Planar source.
+     * @param dst      Interleaved destination.
+     * @param channels
+     * @param length   Number of frames.
+     */
+    inline void interleave(const float *src, float *dst, unsigned channels, unsigned length) {
+        arch::interleave(src, dst, channels, length, length);
+    }
+
+    /**
+     * @brief dst[c * length + i] = src[i * channels + c]
+     *
+     * Vectorized for 1, 2, 4, 6 and 8 channels.
+     *
+     * @param src      Interleaved source.
+     * @param dst      Planar destination.
+     * @param channels
+     * @param length   Number of frames.
+     */
+    inline void deinterleave(const float *src, float *dst, unsigned channels, unsigned length) {
+        arch::deinterleave(src, dst, channels, length, length);
+    }
+
+    /**
+     * @brief dst[c * stride + i] = src[i * channels + c]
+     *
+     * Deinterleaves into the first length frames of planar channels that are
+     * stride frames apart.
+     *
+     * @param src      Interleaved source.
+     * @param dst      Planar destination.
+     * @param channels
+     * @param length   Number of frames.
+     * @param stride   Distance between the destination channels.
+     */
+    inline void deinterleave(const float *src, float *dst, unsigned channels, unsigned length, unsigned stride) {
+        arch::deinterleave(src, dst, channels, length, stride);
+    }
+
+    /**
+     * @brief Radix-4 decimation-in-time FFT butterflies over a block of 4
+     * sub-transforms of interleaved complex values.
+     *
+     * @param signal    Block of 4 * stride complex values.
+     * @param twiddles  Twiddle factors of the 2nd, 3rd and 4th sub-transforms,
+     * each of stride complex values.
+     * @param stride    Length of each sub-transform.
+     * @param length    Number of butterflies.
+     * @param inverse   Forward or inverse transform.
+     */
+    inline void radix4(float *signal, const float *twiddles, unsigned stride, unsigned length, bool inverse) {
+        arch::radix4(signal, twiddles, stride, length, inverse);
+    }
+
+    /**
+     * @brief Radix-4 decimation-in-time FFT butterflies sharing the same
+     * twiddle factors, for batches of signals interleaved across lanes.
+     *
+     * @param signal         Block of 4 * stride complex values.
+     * @param twiddles       Twiddle factor of the 2nd sub-transform, followed
+     * by those of the 3rd and 4th sub-transforms every twiddle_stride complex
+     * values.
+     * @param stride         Distance between the sub-transforms.
+     * @param twiddle_stride Distance between the twiddle factors.
+     * @param length         Number of butterflies.
+     * @param inverse        Forward or inverse transform.
+     */
+    inline void radix4_lanes(float *signal,
+                             const float *twiddles,
+                             unsigned stride,
+                             unsigned twiddle_stride,
+                             unsigned length,
+                             bool inverse) {
+        arch::radix4_lanes(signal, twiddles, stride, twiddle_stride, length, inverse);
+    }
 } // namespace Dynamo::Vectorize
\ No newline at end of file
@@ -12,66 +12,105 @@ namespace Dynamo::Sound {
         Vectorize::vsma(src[src_channel], scalar, dst[dst_channel], src.frames());
     }
 
+    std::shared_ptr<WaveSample[]> Buffer::allocate(unsigned length) {
+        WaveSample *samples = new (std::align_val_t(64)) WaveSample[length];
+        return std::shared_ptr<WaveSample[]>(samples, [](WaveSample *ptr) {
+            ::operator delete[](ptr, std::align_val_t(64));
+        });
+    }
+
     Buffer::Buffer(unsigned frames, unsigned channels) : _frames(frames), _channels(channels) {
-        unsigned length = std::max(frames * channels, 1U);
-        _samples = new (std::align_val_t(64)) WaveSample[length];
+        _capacity = std::max(frames * channels, 1U);
+        _samples = allocate(_capacity);
     }
 
     Buffer::Buffer(WaveSample *samples, unsigned frames, unsigned channels) : Buffer(frames, channels) {
-        std::copy(samples, samples + (_frames * _channels), _samples);
+        std::copy(samples, samples + (_frames * _channels), _samples.get());
     }
 
-    Buffer::Buffer(const Buffer &rhs) : Buffer(rhs._frames, rhs._channels) {
-        std::copy(rhs._samples, rhs._samples + (_frames * _channels), _samples);
-    }
+    Buffer::Buffer(std::shared_ptr<WaveSample[]> samples, unsigned frames, unsigned channels) :
+        _samples(std::move(samples)), _frames(frames), _channels(channels), _capacity(frames * channels) {}
 
-    Buffer::~Buffer() { delete[] _samples; }
+    Buffer::Buffer(const Buffer &rhs) :
+        _samples(rhs._samples), _frames(rhs._frames), _channels(rhs._channels), _capacity(rhs._capacity) {}
 
-    Buffer &Buffer::operator=(const Buffer &rhs) {
-        unsigned prev_size = _frames * _channels;
-        unsigned next_size = rhs._frames * rhs._channels;
+    Buffer::Buffer(Buffer &&rhs) noexcept :
+        _samples(std::move(rhs._samples)), _frames(rhs._frames), _channels(rhs._channels),
+        _capacity(rhs._capacity) {
+        rhs._frames = 0;
+        rhs._channels = 0;
+        rhs._capacity = 0;
+    }
 
-        // Reallocate the sample container if necessary
-        if (next_size > prev_size) {
-            delete[] _samples;
-            _samples = new (std::align_val_t(64)) WaveSample[next_size];
-        }
+    Buffer::~Buffer() = default;
 
+    Buffer &Buffer::operator=(const Buffer &rhs) {
+        _samples = rhs._samples;
         _frames = rhs._frames;
         _channels = rhs._channels;
-        std::copy(rhs._samples, rhs._samples + next_size, _samples);
+        _capacity = rhs._capacity;
+        return *this;
+    }
 
+    Buffer &Buffer::operator=(Buffer &&rhs) noexcept {
+        _samples = std::move(rhs._samples);
+        _frames = rhs._frames;
+        _channels = rhs._channels;
+        _capacity = rhs._capacity;
+        rhs._frames = 0;
+        rhs._channels = 0;
+        rhs._capacity = 0;
         return *this;
     }
 
+    void Buffer::detach() {
+        if (_samples.use_count() <= 1) return;
+
+        // Copy the samples into a private store
+        unsigned size = _frames * _channels;
+        std::shared_ptr<WaveSample[]> samples = allocate(std::max(size, 1U));
+        std::copy(_samples.get(), _samples.get() + size, samples.get());
+        _samples = std::move(samples);
+        _capacity = std::max(size, 1U);
+    }
+
     WaveSample *Buffer::operator[](const unsigned channel) {
         DYN_ASSERT(channel < _channels);
-        return _samples + (_frames * channel);
+        detach();
+        return _samples.get() + (_frames * channel);
     }
 
     const WaveSample *Buffer::operator[](const unsigned channel) const {
         DYN_ASSERT(channel < _channels);
-        return _samples + (_frames * channel);
+        return _samples.get() + (_frames * channel);
     }
 
-    WaveSample *Buffer::data() { return _samples; }
+    WaveSample *Buffer::data() {
+        detach();
+        return _samples.get();
+    }
 
-    const WaveSample *Buffer::data() const { return _samples; }
+    const WaveSample *Buffer::data() const { return _samples.get(); }
 
     unsigned Buffer::frames() const { return _frames; }
 
     unsigned Buffer::channels() const { return _channels; }
 
-    void Buffer::silence() { std::fill(_samples, _samples + (_frames * _channels), 0); }
+    bool Buffer::shared() const { return _samples.use_count() > 1; }
+
+    void Buffer::silence() {
+        detach();
+        std::fill(_samples.get(), _samples.get() + (_frames * _channels), 0);
+    }
 
     void Buffer::resize(const unsigned frames, const unsigned channels) {
-        unsigned prev_size = _frames * _channels;
         unsigned next_size = frames * channels;
 
-        // Reallocate the sample container if necessary
-        if (next_size > prev_size) {
-            delete[] _samples;
-            _samples = new (std::align_val_t(64)) WaveSample[next_size];
+        // Reallocate the sample container if necessary, without copying a
+        // shared store
+        if (next_size > _capacity || _samples.use_count() > 1) {
+            _capacity = std::max(next_size, 1U);
+            _samples = allocate(_capacity);
         }
 
         _frames = frames;
@@ -82,8 +121,12 @@ namespace Dynamo::Sound {
         unsigned src_channels = channels();
         unsigned dst_channels = dst.channels();
 
-        // Handle different channel combinations
-        unsigned u = (1 << (src_channels + 7)) | (1 << (dst_channels - 1));
+        // Handle different channel combinations, remixing discretely beyond
+        // the named layouts so the mode bits cannot overflow
+        unsigned u = 0;
+        if (src_channels <= 8 && dst_channels <= 8) {
+            u = (1 << (src_channels + 7)) | (1 << (dst_channels - 1));
+        }
         switch (static_cast<ChannelRemixMode>(u)) {
         case ChannelRemixMode::C_1_2:
             // L = M
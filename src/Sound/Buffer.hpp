@@ -1,6 +1,7 @@
 #pragma once
 
 #include <functional>
+#include <memory>
 
 #include <Utils/Log.hpp>
 
@@ -39,13 +40,38 @@ namespace Dynamo::Sound {
     /**
      * @brief Deinterleaved multi-channel buffer for WaveSamples.
      *
+     * Copies share a reference-counted sample store, so many sources can play
+     * the same clip without duplicating it. The store is copied the first time
+     * a shared buffer is modified.
+     *
      */
     class Buffer {
-        WaveSample *_samples;
+        std::shared_ptr<WaveSample[]> _samples;
 
         unsigned _frames;
         unsigned _channels;
 
+        /**
+         * @brief Number of samples allocated, which may exceed the size.
+         *
+         */
+        unsigned _capacity;
+
+        /**
+         * @brief Allocate an aligned sample store.
+         *
+         * @param length Number of samples.
+         * @return std::shared_ptr<WaveSample[]>
+         */
+        static std::shared_ptr<WaveSample[]> allocate(unsigned length);
+
+        /**
+         * @brief Copy the sample store if it is shared with another buffer,
+         * before it is modified.
+         *
+         */
+        void detach();
+
       public:
         /**
          * @brief Construct an empty Buffer.
@@ -64,12 +90,31 @@ namespace Dynamo::Sound {
         Buffer(WaveSample *samples, unsigned frames, unsigned channels);
 
         /**
-         * @brief Copy constructor.
+         * @brief Construct a Buffer viewing an existing sample store, e.g., a
+         * memory-mapped file.
+         *
+         * The store is released by its deleter once no buffer shares it.
+         *
+         * @param samples  Sample store of frames * channels planar samples.
+         * @param frames   Number of frames.
+         * @param channels Number of channels.
+         */
+        Buffer(std::shared_ptr<WaveSample[]> samples, unsigned frames, unsigned channels);
+
+        /**
+         * @brief Copy constructor, sharing the sample store.
          *
          * @param rhs
          */
         Buffer(const Buffer &rhs);
 
+        /**
+         * @brief Move constructor, leaving rhs empty.
+         *
+         * @param rhs
+         */
+        Buffer(Buffer &&rhs) noexcept;
+
         /**
          * @brief Destroy a Buffer.
          *
@@ -77,16 +122,26 @@ namespace Dynamo::Sound {
         ~Buffer();
 
         /**
-         * @brief Copy assignment.
+         * @brief Copy assignment, sharing the sample store.
          *
          * @param rhs
          * @return Buffer&
          */
         Buffer &operator=(const Buffer &rhs);
 
+        /**
+         * @brief Move assignment, leaving rhs empty.
+         *
+         * @param rhs
+         * @return Buffer&
+         */
+        Buffer &operator=(Buffer &&rhs) noexcept;
+
         /**
          * @brief Get the pointer to the start of a channel.
          *
+         * This copies the sample store if it is shared.
+         *
          * @param channel Channel index.
          * @return WaveSample*
          */
@@ -103,6 +158,8 @@ namespace Dynamo::Sound {
         /**
          * @brief Get internal data pointer.
          *
+         * This copies the sample store if it is shared.
+         *
          * @return WaveSample*
          */
         WaveSample *data();
@@ -128,6 +185,14 @@ namespace Dynamo::Sound {
          */
         unsigned channels() const;
 
+        /**
+         * @brief Is the sample store shared with another buffer?
+         *
+         * @return true
+         * @return false
+         */
+        bool shared() const;
+
         /**
          * @brief Silence the buffer.
          *
@@ -137,7 +202,8 @@ namespace Dynamo::Sound {
         /**
          * @brief Resize the container to fit a number of frames and channels.
          *
-         * This will not preserve the existing data.
+         * This will not preserve the existing data. The container is only
+         * reallocated if it grows past its capacity.
          *
          * @param frames   Number of frames.
          * @param channels Number of channels.
@@ -0,0 +1,149 @@
+#include <Math/Common.hpp>
+#include <Math/Vectorize.hpp>
+#include <Sound/DSP/Ambisonics.hpp>
+#include <Sound/DSP/HRTF.hpp>
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+namespace Dynamo::Sound {
+    /**
+     * @brief Max-rE weights of each order, indexed by the maximum order.
+     *
+     * These are the Legendre polynomials evaluated at the largest root of
+     * the polynomial one order above the maximum.
+     *
+     */
+    static constexpr std::array<std::array<float, MAX_AMBISONIC_ORDER + 1>, MAX_AMBISONIC_ORDER + 1>
+        MAX_RE_WEIGHTS = {{
+            {1, 0, 0, 0},
+            {1, 0.577350f, 0, 0},
+            {1, 0.774597f, 0.4f, 0},
+            {1, 0.861136f, 0.612334f, 0.304747f},
+        }};
+
+    void encode_ambisonic(const Vec3 &direction, unsigned order, float *coefficients) {
+        DYN_ASSERT(order <= MAX_AMBISONIC_ORDER);
+        float x = direction.x;
+        float y = direction.y;
+        float z = direction.z;
+
+        coefficients[0] = 1;
+        if (order < 1) return;
+        coefficients[1] = y;
+        coefficients[2] = z;
+        coefficients[3] = x;
+        if (order < 2) return;
+
+        float sqrt3 = std::sqrt(3.0f);
+        coefficients[4] = sqrt3 * x * y;
+        coefficients[5] = sqrt3 * y * z;
+        coefficients[6] = 0.5f * (3 * z * z - 1);
+        coefficients[7] = sqrt3 * x * z;
+        coefficients[8] = 0.5f * sqrt3 * (x * x - y * y);
+        if (order < 3) return;
+
+        float sqrt5_8 = std::sqrt(5.0f / 8);
+        float sqrt3_8 = std::sqrt(3.0f / 8);
+        float sqrt15 = std::sqrt(15.0f);
+        coefficients[9] = sqrt5_8 * y * (3 * x * x - y * y);
+        coefficients[10] = sqrt15 * x * y * z;
+        coefficients[11] = sqrt3_8 * y * (5 * z * z - 1);
+        coefficients[12] = 0.5f * z * (5 * z * z - 3);
+        coefficients[13] = sqrt3_8 * x * (5 * z * z - 1);
+        coefficients[14] = 0.5f * sqrt15 * z * (x * x - y * y);
+        coefficients[15] = sqrt5_8 * x * (x * x - 3 * y * y);
+    }
+
+    AmbisonicDecoder::AmbisonicDecoder(unsigned order) : _order(order) {
+        DYN_ASSERT(order >= 1 && order <= MAX_AMBISONIC_ORDER);
+        const HRTF &hrtf = HRTF::get();
+
+        // Spread the virtual speakers evenly over the sphere
+        unsigned speaker_count = 2 * channels();
+        float golden_angle = M_PI * (3 - std::sqrt(5.0f));
+        for (unsigned k = 0; k < speaker_count; k++) {
+            float z = 1 - (2 * k + 1) / static_cast<float>(speaker_count);
+            float r = std::sqrt(1 - z * z);
+            _speakers.emplace_back(r * std::cos(golden_angle * k), r * std::sin(golden_angle * k), z);
+        }
+
+        // Convolve each speaker feed with the HRIR of its direction
+        unsigned partition_length = hrtf.partition_count() * BLOCK_BINS;
+        _partitions.resize(2 * partition_length);
+        _convolvers.resize(speaker_count);
+        for (unsigned k = 0; k < speaker_count; k++) {
+            // Point in the interaural-polar space of the HRTF
+            const Vec3 &speaker = _speakers[k];
+            float azimuth = to_degrees(std::asin(std::clamp(speaker.x, -1.0f, 1.0f)));
+            float elevation = to_degrees(std::atan2(-speaker.z, speaker.y));
+            if (elevation < -90) {
+                elevation += 360;
+            }
+
+            HRIRWeights weights = hrtf.calculate_weights(Vec2(azimuth, elevation));
+            for (unsigned c = 0; c < 2; c++) {
+                hrtf.calculate_HRIR_partitions(weights, c, _partitions.data() + c * partition_length);
+            }
+            _convolvers[k].initialize(_partitions.data(), hrtf.partition_count(), 2);
+        }
+
+        // Weight each order of the sampling decoder, normalizing SN3D
+        for (unsigned l = 0; l <= order; l++) {
+            _order_weights.push_back((2 * l + 1) * MAX_RE_WEIGHTS[order][l] / speaker_count);
+        }
+        compute_gains(_rotation);
+    }
+
+    void AmbisonicDecoder::compute_gains(const Quaternion &rotation) {
+        unsigned channel_count = channels();
+        _gains.resize(_speakers.size() * channel_count);
+        for (unsigned k = 0; k < _speakers.size(); k++) {
+            // Sample the bus in the world direction of the speaker
+            float *gains = _gains.data() + k * channel_count;
+            encode_ambisonic(rotation.rotate(_speakers[k]), _order, gains);
+            for (unsigned l = 0; l <= _order; l++) {
+                for (unsigned n = l * l; n < (l + 1) * (l + 1); n++) {
+                    gains[n] *= _order_weights[l];
+                }
+            }
+        }
+        _rotation = rotation;
+    }
+
+    unsigned AmbisonicDecoder::order() const { return _order; }
+
+    unsigned AmbisonicDecoder::channels() const { return ambisonic_channels(_order); }
+
+    unsigned AmbisonicDecoder::speakers() const { return _speakers.size(); }
+
+    void AmbisonicDecoder::decode(const Buffer &bus, Buffer &dst, const Quaternion &rotation) {
+        DYN_ASSERT(bus.channels() == channels());
+        if (rotation.x != _rotation.x || rotation.y != _rotation.y || rotation.z != _rotation.z ||
+            rotation.w != _rotation.w) {
+            compute_gains(rotation);
+        }
+
+        unsigned frames = bus.frames();
+        dst.resize(frames, 2);
+        dst.silence();
+        _feed.resize(frames, 1);
+        _ears.resize(frames, 2);
+
+        unsigned channel_count = channels();
+        for (unsigned k = 0; k < _speakers.size(); k++) {
+            // Mix the speaker feed from the bus channels
+            const float *gains = _gains.data() + k * channel_count;
+            _feed.silence();
+            for (unsigned n = 0; n < channel_count; n++) {
+                Vectorize::vsma(bus[n], gains[n], _feed[0], frames);
+            }
+
+            // Convolve with the speaker HRIR for both ears
+            _convolvers[k].compute(_feed[0], _ears, frames);
+            for (unsigned c = 0; c < 2; c++) {
+                Vectorize::vadd(_ears[c], dst[c], dst[c], frames);
+            }
+        }
+    }
+} // namespace Dynamo::Sound
\ No newline at end of file
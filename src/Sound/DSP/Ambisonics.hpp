@@ -0,0 +1,126 @@
+#pragma once
+
+#include <vector>
+
+#include <Math/Complex.hpp>
+#include <Math/Quaternion.hpp>
+#include <Math/Vec3.hpp>
+
+#include <Sound/Buffer.hpp>
+#include <Sound/DSP/Convolver.hpp>
+
+namespace Dynamo::Sound {
+    /**
+     * @brief Highest supported ambisonic order.
+     *
+     */
+    static constexpr unsigned MAX_AMBISONIC_ORDER = 3;
+
+    /**
+     * @brief Get the number of B-format channels of an ambisonic order.
+     *
+     * @param order
+     * @return constexpr unsigned
+     */
+    constexpr unsigned ambisonic_channels(unsigned order) { return (order + 1) * (order + 1); }
+
+    /**
+     * @brief Evaluate the real spherical harmonics of a direction, in ACN
+     * channel order with SN3D normalization (AmbiX).
+     *
+     * A signal multiplied by these coefficients is encoded as a plane wave
+     * arriving from the direction.
+     *
+     * @param direction    Unit direction vector.
+     * @param order
+     * @param coefficients Output of ambisonic_channels(order) values.
+     */
+    void encode_ambisonic(const Vec3 &direction, unsigned order, float *coefficients);
+
+    /**
+     * @brief Binaural decoder of a B-format bus.
+     *
+     * The bus is decoded to a fixed set of virtual speakers around the head,
+     * each convolved with the HRIR of its direction. The cost depends on the
+     * order but not on the number of sources encoded into the bus.
+     *
+     */
+    class AmbisonicDecoder {
+        unsigned _order;
+
+        /**
+         * @brief Directions of the virtual speakers relative to the head.
+         *
+         */
+        std::vector<Vec3> _speakers;
+
+        /**
+         * @brief Gain of each bus channel in each speaker feed, updated with
+         * the listener rotation.
+         *
+         */
+        std::vector<float> _gains;
+        Quaternion _rotation;
+
+        /**
+         * @brief Per-order weights that narrow the decoded lobes (max-rE).
+         *
+         */
+        std::vector<float> _order_weights;
+
+        std::vector<Convolver> _convolvers;
+        std::vector<Complex> _partitions;
+
+        Buffer _feed;
+        Buffer _ears;
+
+        /**
+         * @brief Compute the decoding gains for a listener rotation.
+         *
+         * @param rotation
+         */
+        void compute_gains(const Quaternion &rotation);
+
+      public:
+        /**
+         * @brief Construct a new AmbisonicDecoder object.
+         *
+         * @param order Ambisonic order, from 1 to MAX_AMBISONIC_ORDER.
+         */
+        AmbisonicDecoder(unsigned order);
+
+        /**
+         * @brief Get the ambisonic order.
+         *
+         * @return unsigned
+         */
+        unsigned order() const;
+
+        /**
+         * @brief Get the number of B-format channels.
+         *
+         * @return unsigned
+         */
+        unsigned channels() const;
+
+        /**
+         * @brief Get the number of virtual speakers.
+         *
+         * @return unsigned
+         */
+        unsigned speakers() const;
+
+        /**
+         * @brief Decode a chunk of the bus to binaural stereo.
+         *
+         * Sources are encoded into the bus by their direction in world
+         * space. The bus is rotated into the head by the listener rotation,
+         * so turning the head costs no more than recomputing the gains.
+         *
+         * @param bus      B-format bus with channels() channels.
+         * @param dst      Destination buffer, resized to 2 channels.
+         * @param rotation Listener rotation.
+         */
+        void decode(const Buffer &bus, Buffer &dst, const Quaternion &rotation);
+    };
+} // namespace Dynamo::Sound
\ No newline at end of file
@@ -1,62 +1,121 @@
+#include <algorithm>
+
 #include <Math/Fourier.hpp>
+#include <Math/Vectorize.hpp>
 #include <Sound/DSP/Convolver.hpp>
 
 namespace Dynamo::Sound {
-    void Convolver::initialize(WaveSample *ir, unsigned M) {
-        // Initialize the partition buffer
-        _partition_count = std::ceil(static_cast<float>(M) / BLOCK_LENGTH);
-        _partitions.resize(_partition_count * BLOCK_LENGTH_2);
-        std::fill(_partitions.begin(), _partitions.end(), 0);
+    Convolver::Convolver(unsigned block_length) :
+        _block_length(block_length), _input(block_length * 2, 0), _output(block_length * 2),
+        _spectrum(block_length + 1), _accumulator((block_length + 1) * 2), _fdl_head(0), _partition_count(0),
+        _output_count(0) {
+        DYN_ASSERT(round_pow2(_block_length) == _block_length);
+    }
+
+    unsigned Convolver::partition_count(unsigned M, unsigned block_length) {
+        return std::ceil(static_cast<float>(M) / block_length);
+    }
+
+    void Convolver::transform_partitions(const WaveSample *ir, unsigned M, Complex *dst, unsigned block_length) {
+        unsigned count = partition_count(M, block_length);
+        unsigned bins = block_length + 1;
+        std::vector<WaveSample> partition(block_length * 2, 0);
 
         // Copy impulse response and pre-compute the FFT of each partition
-        for (unsigned i = 0; i < _partition_count; i++) {
-            unsigned ir_offset = i * BLOCK_LENGTH;
-            unsigned partition_offset = i * BLOCK_LENGTH_2;
+        for (unsigned i = 0; i < count; i++) {
+            unsigned ir_offset = i * block_length;
 
-            unsigned copy_size = std::min(BLOCK_LENGTH, M);
-            std::copy(ir + ir_offset, ir + ir_offset + copy_size, _partitions.data() + partition_offset);
-            Fourier::transform(_partitions.data() + partition_offset, BLOCK_LENGTH_2);
+            unsigned copy_size = std::min(block_length, M);
+            std::copy(ir + ir_offset, ir + ir_offset + copy_size, partition.begin());
+            std::fill(partition.begin() + copy_size, partition.end(), 0);
+            Fourier::transform_real(partition.data(), dst + i * bins, block_length * 2);
 
             M -= copy_size;
         }
+    }
 
-        // Resize the frequency delay-line, do not zero out
-        _fdl.resize(_partition_count * BLOCK_LENGTH_2);
+    void Convolver::initialize(const WaveSample *ir, unsigned M) {
+        std::vector<Complex> partitions(partition_count(M, _block_length) * (_block_length + 1));
+        transform_partitions(ir, M, partitions.data(), _block_length);
+        initialize(partitions.data(), partition_count(M, _block_length));
     }
 
-    void Convolver::compute(WaveSample *src, WaveSample *dst, unsigned N) {
+    void Convolver::initialize(const Complex *partitions, unsigned partition_count, unsigned output_count) {
+        unsigned bins = _block_length + 1;
+        _partition_count = partition_count;
+        _output_count = output_count;
+
+        // Split the pre-computed partitions into real and imaginary parts
+        _partitions.resize(_output_count * _partition_count * bins * 2);
+        for (unsigned i = 0; i < _output_count * _partition_count; i++) {
+            const float *src = reinterpret_cast<const float *>(partitions + i * bins);
+            Vectorize::deinterleave(src, _partitions.data() + i * bins * 2, 2, bins);
+        }
+
+        // Resize the frequency delay-line, only zero out if it changed
+        if (_fdl.size() != _partition_count * bins * 2) {
+            _fdl.assign(_partition_count * bins * 2, 0);
+            _fdl_head = 0;
+        }
+    }
+
+    void Convolver::forward(WaveSample *src, unsigned N) {
+        unsigned bins = _block_length + 1;
+
         // Shift back the second half of the input buffer
-        std::copy(_input.begin() + BLOCK_LENGTH, _input.begin() + BLOCK_LENGTH_2, _input.begin());
+        std::copy(_input.begin() + _block_length, _input.end(), _input.begin());
 
         // Read the latest samples, zeroing out the remainder of buffer
-        std::copy(src, src + N, _input.begin() + BLOCK_LENGTH);
-        std::fill(_input.begin() + BLOCK_LENGTH + N, _input.begin() + BLOCK_LENGTH_2, 0);
+        std::copy(src, src + N, _input.begin() + _block_length);
+        std::fill(_input.begin() + _block_length + N, _input.end(), 0);
 
-        // Shift up the frequency delay-line by one partition
-        std::copy(_fdl.begin(), _fdl.end() - BLOCK_LENGTH_2, _fdl.begin() + BLOCK_LENGTH_2);
+        // Forward transform the input block
+        Fourier::transform_real(_input.data(), _spectrum.data(), _input.size());
 
-        // Forward transform the input block onto the frequency delay-line
-        std::copy(_input.begin(), _input.end(), _fdl.begin());
-        Fourier::transform(_fdl.data(), BLOCK_LENGTH_2);
+        // Move the head back by one partition, overwriting the oldest
+        _fdl_head = (_fdl_head + _partition_count - 1) % _partition_count;
+        float *head = _fdl.data() + _fdl_head * bins * 2;
+        Vectorize::deinterleave(reinterpret_cast<float *>(_spectrum.data()), head, 2, bins);
+    }
+
+    void Convolver::accumulate(unsigned output, WaveSample *dst, unsigned N) {
+        unsigned bins = _block_length + 1;
+        const float *partitions = _partitions.data() + output * _partition_count * bins * 2;
 
-        // Convolve with each partition
-        std::fill(_output.begin(), _output.end(), 0);
+        // Convolve each partition with its block in the delay-line
+        float *acc_re = _accumulator.data();
+        float *acc_im = acc_re + bins;
+        std::fill(_accumulator.begin(), _accumulator.end(), 0);
         for (unsigned i = 0; i < _partition_count; i++) {
-            unsigned offset = BLOCK_LENGTH_2 * i;
+            unsigned slot = _fdl_head + i;
+            if (slot >= _partition_count) {
+                slot -= _partition_count;
+            }
+            const float *fdl = _fdl.data() + slot * bins * 2;
+            const float *partition = partitions + i * bins * 2;
 
             // Pointwise multiply and accumulate onto the output buffer
-            for (unsigned j = 0; j < BLOCK_LENGTH_2; j++) {
-                unsigned j_offset = offset + j;
-                _output[j] += _fdl[j_offset] * _partitions[j_offset];
-            }
+            Vectorize::vcma(fdl, fdl + bins, partition, partition + bins, acc_re, acc_im, bins);
         }
 
         // Inverse transform the output buffer
-        Fourier::inverse(_output.begin(), _output.size());
+        Vectorize::interleave(acc_re, reinterpret_cast<float *>(_spectrum.data()), 2, bins);
+        Fourier::inverse_real(_spectrum.data(), _output.data(), _output.size());
 
         // Write the second half of the output buffer
-        for (unsigned i = 0; i < N; i++) {
-            dst[i] = _output[i + BLOCK_LENGTH].re;
+        std::copy(_output.begin() + _block_length, _output.begin() + _block_length + N, dst);
+    }
+
+    void Convolver::compute(WaveSample *src, WaveSample *dst, unsigned N) {
+        forward(src, N);
+        accumulate(0, dst, N);
+    }
+
+    void Convolver::compute(WaveSample *src, Buffer &dst, unsigned N) {
+        DYN_ASSERT(dst.channels() >= _output_count);
+        forward(src, N);
+        for (unsigned i = 0; i < _output_count; i++) {
+            accumulate(i, dst[i], N);
         }
     }
 } // namespace Dynamo::Sound
\ No newline at end of file
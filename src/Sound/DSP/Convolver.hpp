@@ -1,6 +1,5 @@
 #pragma once
 
-#include <array>
 #include <vector>
 
 #include <Math/Complex.hpp>
@@ -23,60 +22,170 @@ namespace Dynamo::Sound {
      */
     static constexpr unsigned BLOCK_LENGTH_2 = BLOCK_LENGTH << 1;
 
+    /**
+     * @brief Number of frequency bins in the real FFT of a partition unit
+     *
+     */
+    static constexpr unsigned BLOCK_BINS = BLOCK_LENGTH + 1;
+
     /**
      * @brief Signal convolution engine
      *
      * This implements the overlap-save block algorithm to compute convolutions
-     * in real-time
+     * in real-time. A single input can be convolved with multiple impulse
+     * responses, sharing the forward transform and frequency delay-line.
      *
      */
     class Convolver {
+        /**
+         * @brief Length of a subfilter unit, must be a power of 2
+         *
+         */
+        unsigned _block_length;
+
         /**
          * @brief Input sample buffer
          *
          */
-        std::array<WaveSample, BLOCK_LENGTH_2> _input = {0};
+        std::vector<WaveSample> _input;
 
         /**
          * @brief Output sample buffer
          *
          */
-        std::array<Complex, BLOCK_LENGTH_2> _output = {0};
+        std::vector<WaveSample> _output;
 
         /**
-         * @brief Frequency delay line
+         * @brief Frequency bin buffer
          *
          */
-        std::vector<Complex> _fdl;
+        std::vector<Complex> _spectrum;
 
         /**
-         * @brief Partitioned FFT transforms of the impulse response
+         * @brief Split real and imaginary output accumulator
          *
          */
-        std::vector<Complex> _partitions;
+        std::vector<float> _accumulator;
 
         /**
-         * @brief Number of partitions
+         * @brief Circular frequency delay-line of split real and imaginary
+         * partitions
+         *
+         */
+        std::vector<float> _fdl;
+
+        /**
+         * @brief Index of the most recent partition in the frequency
+         * delay-line
+         *
+         */
+        unsigned _fdl_head;
+
+        /**
+         * @brief Partitioned FFT transforms of each impulse response, split
+         * into real and imaginary parts
+         *
+         */
+        std::vector<float> _partitions;
+
+        /**
+         * @brief Number of partitions per impulse response
          *
          */
         unsigned _partition_count;
 
+        /**
+         * @brief Number of impulse responses
+         *
+         */
+        unsigned _output_count;
+
+        /**
+         * @brief Read a sound chunk and transform it onto the frequency
+         * delay-line
+         *
+         * @param src Source sound buffer
+         * @param N   Length of the sound
+         */
+        void forward(WaveSample *src, unsigned N);
+
+        /**
+         * @brief Apply an impulse response to the frequency delay-line
+         *
+         * @param output Index of the impulse response
+         * @param dst    Destination sound buffer
+         * @param N      Length of the sound
+         */
+        void accumulate(unsigned output, WaveSample *dst, unsigned N);
+
       public:
+        /**
+         * @brief Construct a new Convolver object
+         *
+         * @param block_length Length of a subfilter unit, must be a power of 2
+         */
+        Convolver(unsigned block_length = BLOCK_LENGTH);
+
+        /**
+         * @brief Compute the number of partitions needed for an impulse
+         * response
+         *
+         * @param M            Length of the impulse response
+         * @param block_length Length of a subfilter unit
+         * @return unsigned
+         */
+        static unsigned partition_count(unsigned M, unsigned block_length = BLOCK_LENGTH);
+
+        /**
+         * @brief Partition an impulse response and pre-compute the FFT of
+         * each partition
+         *
+         * @param ir           Impulse response buffer
+         * @param M            Length of the impulse response
+         * @param dst          Destination buffer of partition_count(M) *
+         * (block_length + 1) frequency bins
+         * @param block_length Length of a subfilter unit
+         */
+        static void
+        transform_partitions(const WaveSample *ir, unsigned M, Complex *dst, unsigned block_length = BLOCK_LENGTH);
+
         /**
          * @brief Set the impulse response to convolve
          *
          * @param ir Impulse response buffer
          * @param M  Length of the impulse response
          */
-        void initialize(WaveSample *ir, unsigned M);
+        void initialize(const WaveSample *ir, unsigned M);
+
+        /**
+         * @brief Set the impulse responses to convolve from their pre-computed
+         * partition transforms
+         *
+         * @param partitions      Partition buffers from transform_partitions(),
+         * one after another for each impulse response
+         * @param partition_count Number of partitions per impulse response
+         * @param output_count    Number of impulse responses
+         */
+        void initialize(const Complex *partitions, unsigned partition_count, unsigned output_count = 1);
 
         /**
          * @brief Apply the impulse repsonse to a sound chunk
          *
          * @param src Source sound buffer
          * @param dst Destination sound buffer
-         * @param N   Length of the sound, must be <= MAX_CHUNK_LENGTH
+         * @param N   Length of the sound, must be <= the block length
          */
         void compute(WaveSample *src, WaveSample *dst, unsigned N);
+
+        /**
+         * @brief Apply each impulse response to a sound chunk, writing the
+         * result of the i-th impulse response to the i-th channel
+         *
+         * @param src Source sound buffer
+         * @param dst Destination sound buffer with at least as many channels
+         * as impulse responses
+         * @param N   Length of the sound, must be <= the block length
+         */
+        void compute(WaveSample *src, Buffer &dst, unsigned N);
     };
 } // namespace Dynamo::Sound
\ No newline at end of file
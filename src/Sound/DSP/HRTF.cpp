@@ -1,52 +1,107 @@
-#include <unordered_map>
+#include <algorithm>
+#include <cstring>
 
 #include <Math/Common.hpp>
-#include <Math/Delaunay.hpp>
 #include <Math/Triangle2.hpp>
 #include <Math/Vectorize.hpp>
+#include <Sound/DSP/Convolver.hpp>
 #include <Sound/DSP/HRTF.hpp>
+#include <Sound/Data/HRIR.hpp>
 
 namespace Dynamo::Sound {
     HRTF::HRTF() {
-        // Generate point space
-        for (float az : HRTF_AZIMUTHS) {
-            _points.emplace_back(az, -90);
-            for (unsigned i = 0; i < 50; i++) {
-                float el = -45 + 5.625 * i;
-                _points.emplace_back(az, el);
+        // Register triangles into a grid for faster querying
+        build_grid();
+
+        // Read the HRIR samples for each point
+        unsigned ir_size = HRIR_LENGTH * sizeof(WaveSample);
+        DYN_ASSERT(HRIR_bin_len == HRTF_POINT_COUNT * 2 * ir_size);
+
+        _coeff_map.resize(HRTF_POINT_COUNT);
+        unsigned offset = 0;
+        for (unsigned i = 0; i < HRTF_POINT_COUNT; i++) {
+            Buffer &coeff = _coeff_map[i];
+            coeff.resize(HRIR_LENGTH, 2);
+            for (unsigned c = 0; c < 2; c++) {
+                std::memcpy(coeff[c], HRIR_bin + offset, ir_size);
+                offset += ir_size;
             }
-            _points.emplace_back(az, 270);
         }
-        _coeff_map.resize(_points.size());
 
-        // Map each point to its index
-        std::unordered_map<Vec2, unsigned> index_map;
-        for (unsigned i = 0; i < _points.size(); i++) {
-            index_map[_points[i]] = i;
+        // Pre-compute the convolution partitions of each HRIR
+        _partition_count = Convolver::partition_count(HRIR_LENGTH);
+        unsigned partition_length = _partition_count * BLOCK_BINS;
+        _partition_map.resize(HRTF_POINT_COUNT * 2 * partition_length);
+        for (unsigned i = 0; i < HRTF_POINT_COUNT; i++) {
+            for (unsigned c = 0; c < 2; c++) {
+                Complex *partitions = _partition_map.data() + (i * 2 + c) * partition_length;
+                Convolver::transform_partitions(_coeff_map[i][c], HRIR_LENGTH, partitions);
+            }
         }
+    }
+
+    void HRTF::compute_cell(const Vec2 &point, unsigned &x, unsigned &y) const {
+        Vec2 offset = point - _grid_bounds.min;
+        float fx = std::clamp(offset.x / _grid_cell_size.x, 0.0f, HRTF_GRID_SIZE - 1.0f);
+        float fy = std::clamp(offset.y / _grid_cell_size.y, 0.0f, HRTF_GRID_SIZE - 1.0f);
+        x = fx;
+        y = fy;
+    }
+
+    void HRTF::build_grid() {
+        Vec2 min(HRTF_AZIMUTHS.front(), HRTF_POINTS.front().y);
+        Vec2 max(HRTF_AZIMUTHS.back(), HRTF_POINTS.back().y);
+        _grid_bounds = Box2(min, max);
+        _grid_cell_size = Vec2(_grid_bounds.width(), _grid_bounds.height()) / HRTF_GRID_SIZE;
 
-        // Triangulate points
-        // TODO: Register triangles into a quadtree for faster querying
-        std::vector<Vec2> tmp_points = _points;
-        for (const Triangle2 &triangle : Delaunay::triangulate(tmp_points)) {
-            _indices.push_back(index_map[triangle.a]);
-            _indices.push_back(index_map[triangle.b]);
-            _indices.push_back(index_map[triangle.c]);
+        // Compute the range of cells overlapped by the bounding box of each
+        // triangle
+        unsigned triangle_count = HRTF_TRIANGLE_COUNT;
+        std::vector<std::array<unsigned, 4>> ranges(triangle_count);
+        for (unsigned t = 0; t < triangle_count; t++) {
+            const Vec2 &a = HRTF_POINTS[HRTF_INDICES[t * 3]];
+            const Vec2 &b = HRTF_POINTS[HRTF_INDICES[t * 3 + 1]];
+            const Vec2 &c = HRTF_POINTS[HRTF_INDICES[t * 3 + 2]];
+
+            Vec2 min(std::min({a.x, b.x, c.x}), std::min({a.y, b.y, c.y}));
+            Vec2 max(std::max({a.x, b.x, c.x}), std::max({a.y, b.y, c.y}));
+            compute_cell(min, ranges[t][0], ranges[t][1]);
+            compute_cell(max, ranges[t][2], ranges[t][3]);
         }
 
-        // Read the HRIR samples for each point
-        unsigned offset = 0;
-        for (unsigned i = 0; i < _points.size(); i++) {
-            Buffer &coeff = _coeff_map[i];
-            coeff.resize(HRIR_LENGTH, 2);
-            for (unsigned c = 0; c < 2; c++) {
-                const WaveSample *samples = HRIR_COEFFICIENTS.data() + offset;
-                std::copy(samples, samples + HRIR_LENGTH, coeff[c]);
-                offset += HRIR_LENGTH;
+        // Count the triangles in each cell
+        _grid_offsets.assign(HRTF_GRID_SIZE * HRTF_GRID_SIZE + 1, 0);
+        for (const std::array<unsigned, 4> &range : ranges) {
+            for (unsigned y = range[1]; y <= range[3]; y++) {
+                for (unsigned x = range[0]; x <= range[2]; x++) {
+                    _grid_offsets[y * HRTF_GRID_SIZE + x + 1]++;
+                }
+            }
+        }
+        for (unsigned i = 1; i < _grid_offsets.size(); i++) {
+            _grid_offsets[i] += _grid_offsets[i - 1];
+        }
+
+        // Fill in the triangles of each cell
+        std::vector<unsigned> cursors(_grid_offsets.begin(), _grid_offsets.end() - 1);
+        _grid_triangles.resize(_grid_offsets.back());
+        for (unsigned t = 0; t < triangle_count; t++) {
+            const std::array<unsigned, 4> &range = ranges[t];
+            for (unsigned y = range[1]; y <= range[3]; y++) {
+                for (unsigned x = range[0]; x <= range[2]; x++) {
+                    _grid_triangles[cursors[y * HRTF_GRID_SIZE + x]++] = t;
+                }
             }
         }
     }
 
+    const HRTF &HRTF::get() {
+        static const HRTF hrtf;
+        return hrtf;
+    }
+
+    unsigned HRTF::partition_count() const { return _partition_count; }
+
     Vec2 HRTF::compute_point(const Vec3 &listener_position, const Vec3 &source_position) const {
         Vec3 disp = source_position - listener_position;
 
@@ -59,37 +114,69 @@ namespace Dynamo::Sound {
         return Vec2(to_degrees(azimuth), to_degrees(elevation));
     }
 
-    void HRTF::calculate_HRIR(const Vec3 &listener_position,
-                              const Quaternion &listener_rotation,
-                              const Vec3 &source_position,
-                              Buffer &dst) const {
-        dst.silence();
-        Vec2 point = compute_point(listener_position, source_position);
-        for (unsigned t = 0; t < _indices.size(); t += 3) {
-            unsigned a = _indices[t];
-            unsigned b = _indices[t + 1];
-            unsigned c = _indices[t + 2];
+    HRIRWeights HRTF::calculate_weights(const Vec3 &listener_position,
+                                        const Quaternion &listener_rotation,
+                                        const Vec3 &source_position) const {
+        return calculate_weights(compute_point(listener_position, source_position));
+    }
 
-            Triangle2 triangle(_points[a], _points[b], _points[c]);
+    HRIRWeights HRTF::calculate_weights(const Vec2 &point) const {
+        // Only test the triangles overlapping the cell of the point
+        unsigned x, y;
+        compute_cell(point, x, y);
+        unsigned cell = y * HRTF_GRID_SIZE + x;
+        for (unsigned i = _grid_offsets[cell]; i < _grid_offsets[cell + 1]; i++) {
+            unsigned t = _grid_triangles[i] * 3;
+            unsigned a = HRTF_INDICES[t];
+            unsigned b = HRTF_INDICES[t + 1];
+            unsigned c = HRTF_INDICES[t + 2];
+
+            Triangle2 triangle(HRTF_POINTS[a], HRTF_POINTS[b], HRTF_POINTS[c]);
             Vec3 coords = triangle.barycentric(point);
 
             float eps = 1e-6;
             if (coords.x >= -eps && coords.y >= -eps && coords.z >= -eps) {
-                const Buffer &ir0 = _coeff_map[a];
-                const Buffer &ir1 = _coeff_map[b];
-                const Buffer &ir2 = _coeff_map[c];
-
-                // Use barycentric coordinates to interpolate samples
-                for (unsigned c = 0; c < dst.channels(); c++) {
-                    WaveSample *ptr = dst[c];
-                    unsigned frames = dst.frames();
-                    Vectorize::vsma(ir0[c], coords.x, ptr, frames);
-                    Vectorize::vsma(ir1[c], coords.y, ptr, frames);
-                    Vectorize::vsma(ir2[c], coords.z, ptr, frames);
-                }
-                return;
+                return {{a, b, c}, coords};
             }
         }
         Log::error("HRTF could not triagulate ({} {})", point.x, point.y);
+        return {};
+    }
+
+    void HRTF::calculate_HRIR_partitions(const HRIRWeights &weights, unsigned channel, Complex *dst) const {
+        unsigned partition_length = _partition_count * BLOCK_BINS;
+        unsigned point_stride = 2 * partition_length;
+
+        const Complex *partitions = _partition_map.data() + channel * partition_length;
+        const float *p0 = reinterpret_cast<const float *>(partitions + weights.indices[0] * point_stride);
+        const float *p1 = reinterpret_cast<const float *>(partitions + weights.indices[1] * point_stride);
+        const float *p2 = reinterpret_cast<const float *>(partitions + weights.indices[2] * point_stride);
+
+        // Use barycentric coordinates to interpolate the spectra
+        float *ptr = reinterpret_cast<float *>(dst);
+        unsigned length = partition_length * 2;
+        Vectorize::smul(p0, weights.coords.x, ptr, length);
+        Vectorize::vsma(p1, weights.coords.y, ptr, length);
+        Vectorize::vsma(p2, weights.coords.z, ptr, length);
+    }
+
+    void HRTF::calculate_HRIR(const Vec3 &listener_position,
+                              const Quaternion &listener_rotation,
+                              const Vec3 &source_position,
+                              Buffer &dst) const {
+        HRIRWeights weights = calculate_weights(listener_position, listener_rotation, source_position);
+        const Buffer &ir0 = _coeff_map[weights.indices[0]];
+        const Buffer &ir1 = _coeff_map[weights.indices[1]];
+        const Buffer &ir2 = _coeff_map[weights.indices[2]];
+
+        // Use barycentric coordinates to interpolate samples
+        dst.silence();
+        for (unsigned c = 0; c < dst.channels(); c++) {
+            WaveSample *ptr = dst[c];
+            unsigned frames = dst.frames();
+            Vectorize::vsma(ir0[c], weights.coords.x, ptr, frames);
+            Vectorize::vsma(ir1[c], weights.coords.y, ptr, frames);
+            Vectorize::vsma(ir2[c], weights.coords.z, ptr, frames);
+        }
     }
 } // namespace Dynamo::Sound
\ No newline at end of file
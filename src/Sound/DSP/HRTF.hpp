@@ -1,45 +1,168 @@
 #pragma once
 
+#include <array>
 #include <vector>
 
+#include <Math/Box2.hpp>
+#include <Math/Complex.hpp>
 #include <Math/Quaternion.hpp>
 #include <Math/Vec2.hpp>
 #include <Math/Vec3.hpp>
 
 #include <Sound/Buffer.hpp>
-#include <Sound/Data/HRIR.hpp>
 
 namespace Dynamo::Sound {
     /**
-     * @brief Read the raw HRIR binary data
+     * @brief Length of an HRIR
+     *
+     */
+    static constexpr unsigned HRIR_LENGTH = 200;
+
+    /**
+     * @brief HRTF point space x-coordinates
+     *
+     */
+    static constexpr std::array<float, 27> HRTF_AZIMUTHS = {
+        -90, -80, -65, -55, -45, -40, -35, -30, -25, -20, -15, -10, -5, 0,
+        5,   10,  15,  20,  25,  30,  35,  40,  45,  55,  65,  80,  90,
+    };
+
+    /**
+     * @brief Number of HRTF point space y-coordinates
+     *
+     */
+    static constexpr unsigned HRTF_ELEVATION_COUNT = 52;
+
+    /**
+     * @brief Number of points in the HRTF point space
+     *
+     */
+    static constexpr unsigned HRTF_POINT_COUNT = HRTF_AZIMUTHS.size() * HRTF_ELEVATION_COUNT;
+
+    /**
+     * @brief Number of triangles in the HRTF point space
      *
-     * @return std::vector<WaveSample>
      */
-    static std::vector<WaveSample> read_HRIR_coefficients() {
-        std::vector<WaveSample> buffer(HRIR_bin_len / sizeof(float));
-        std::memcpy(buffer.data(), HRIR_bin, HRIR_bin_len);
-        return buffer;
+    static constexpr unsigned HRTF_TRIANGLE_COUNT = (HRTF_AZIMUTHS.size() - 1) * (HRTF_ELEVATION_COUNT - 1) * 2;
+
+    /**
+     * @brief Compute the HRTF point space y-coordinates
+     *
+     * @return constexpr std::array<float, HRTF_ELEVATION_COUNT>
+     */
+    constexpr std::array<float, HRTF_ELEVATION_COUNT> construct_elevation_table() {
+        std::array<float, HRTF_ELEVATION_COUNT> elevations = {0};
+        elevations[0] = -90;
+        for (unsigned i = 0; i < HRTF_ELEVATION_COUNT - 2; i++) {
+            elevations[i + 1] = -45 + 5.625 * i;
+        }
+        elevations[HRTF_ELEVATION_COUNT - 1] = 270;
+        return elevations;
     }
 
     /**
-     * @brief HRIR coefficients array
+     * @brief Compute the HRTF point space, ordered by azimuth then elevation
      *
+     * @return constexpr std::array<Vec2, HRTF_POINT_COUNT>
      */
-    static const std::vector<WaveSample> HRIR_COEFFICIENTS = read_HRIR_coefficients();
+    constexpr std::array<Vec2, HRTF_POINT_COUNT> construct_point_table() {
+        std::array<float, HRTF_ELEVATION_COUNT> elevations = construct_elevation_table();
+        std::array<Vec2, HRTF_POINT_COUNT> points = {};
+        for (unsigned a = 0; a < HRTF_AZIMUTHS.size(); a++) {
+            for (unsigned e = 0; e < HRTF_ELEVATION_COUNT; e++) {
+                points[a * HRTF_ELEVATION_COUNT + e] = Vec2(HRTF_AZIMUTHS[a], elevations[e]);
+            }
+        }
+        return points;
+    }
 
     /**
-     * @brief Length of an HRIR
+     * @brief Compute the triangulation of the HRTF point space
+     *
+     * The points form a rectilinear lattice, so splitting each cell along a
+     * diagonal yields a Delaunay triangulation.
      *
+     * @return constexpr std::array<unsigned, HRTF_TRIANGLE_COUNT * 3>
      */
-    static constexpr unsigned HRIR_LENGTH = 200;
+    constexpr std::array<unsigned, HRTF_TRIANGLE_COUNT * 3> construct_index_table() {
+        std::array<unsigned, HRTF_TRIANGLE_COUNT * 3> indices = {0};
+        unsigned i = 0;
+        for (unsigned a = 0; a < HRTF_AZIMUTHS.size() - 1; a++) {
+            for (unsigned e = 0; e < HRTF_ELEVATION_COUNT - 1; e++) {
+                unsigned p00 = a * HRTF_ELEVATION_COUNT + e;
+                unsigned p01 = p00 + 1;
+                unsigned p10 = p00 + HRTF_ELEVATION_COUNT;
+                unsigned p11 = p10 + 1;
+
+                indices[i++] = p00;
+                indices[i++] = p10;
+                indices[i++] = p11;
+
+                indices[i++] = p00;
+                indices[i++] = p11;
+                indices[i++] = p01;
+            }
+        }
+        return indices;
+    }
 
     /**
-     * @brief HRTF point space x-coordinates
+     * @brief HRTF point space, precomputed at compile-time
      *
      */
-    static constexpr std::array<float, 27> HRTF_AZIMUTHS = {
-        -90, -80, -65, -55, -45, -40, -35, -30, -25, -20, -15, -10, -5, 0,
-        5,   10,  15,  20,  25,  30,  35,  40,  45,  55,  65,  80,  90,
+    static constexpr std::array<Vec2, HRTF_POINT_COUNT> HRTF_POINTS = construct_point_table();
+
+    /**
+     * @brief HRTF triangle indices into the point space, precomputed at
+     * compile-time
+     *
+     */
+    static constexpr std::array<unsigned, HRTF_TRIANGLE_COUNT * 3> HRTF_INDICES = construct_index_table();
+
+    /**
+     * @brief Number of cells along each axis of the triangle lookup grid
+     *
+     */
+    static constexpr unsigned HRTF_GRID_SIZE = 64;
+
+    /**
+     * @brief Barycentric interpolation weights of the HRIRs surrounding a
+     * point
+     *
+     */
+    struct HRIRWeights {
+        /**
+         * @brief Indices of the triangle vertices
+         *
+         */
+        std::array<unsigned, 3> indices;
+
+        /**
+         * @brief Barycentric coordinates of the point
+         *
+         */
+        Vec3 coords;
+
+        /**
+         * @brief Equality operator
+         *
+         * @param rhs
+         * @return true
+         * @return false
+         */
+        inline bool operator==(const HRIRWeights &rhs) const {
+            return indices == rhs.indices && coords.x == rhs.coords.x && coords.y == rhs.coords.y &&
+                   coords.z == rhs.coords.z;
+        }
+
+        /**
+         * @brief Inequality operator
+         *
+         * @param rhs
+         * @return true
+         * @return false
+         */
+        inline bool operator!=(const HRIRWeights &rhs) const { return !(*this == rhs); }
     };
 
     /**
@@ -48,11 +171,29 @@ namespace Dynamo::Sound {
      *
      */
     class HRTF {
-        std::vector<Vec2> _points;
-        std::vector<unsigned> _indices;
+        /**
+         * @brief Uniform grid over the point space mapping each cell to the
+         * triangles that overlap it
+         *
+         * Triangles of cell i are _grid_triangles[_grid_offsets[i]] to
+         * _grid_triangles[_grid_offsets[i + 1]].
+         *
+         */
+        Box2 _grid_bounds;
+        Vec2 _grid_cell_size;
+        std::vector<unsigned> _grid_offsets;
+        std::vector<unsigned> _grid_triangles;
 
         std::vector<Buffer> _coeff_map;
 
+        /**
+         * @brief Frequency-domain convolution partitions of each HRIR, per
+         * point and channel
+         *
+         */
+        std::vector<Complex> _partition_map;
+        unsigned _partition_count;
+
         /**
          * @brief Compute the azimuth and elevation angles
          *
@@ -62,13 +203,84 @@ namespace Dynamo::Sound {
          */
         Vec2 compute_point(const Vec3 &listener_position, const Vec3 &source_position) const;
 
-      public:
+        /**
+         * @brief Compute the grid cell coordinates containing a point
+         *
+         * @param point
+         * @param x     Column index
+         * @param y     Row index
+         */
+        void compute_cell(const Vec2 &point, unsigned &x, unsigned &y) const;
+
+        /**
+         * @brief Register each triangle into the cells of the lookup grid it
+         * overlaps
+         *
+         */
+        void build_grid();
+
         /**
          * @brief Construct a new HRTF object
          *
          */
         HRTF();
 
+      public:
+        HRTF(const HRTF &) = delete;
+        HRTF &operator=(const HRTF &) = delete;
+
+        /**
+         * @brief Get the process-wide HRTF database, building it on first use
+         *
+         * This is immutable and safe to share between threads.
+         *
+         * @return const HRTF&
+         */
+        static const HRTF &get();
+
+        /**
+         * @brief Get the number of convolution partitions of an HRIR
+         *
+         * @return unsigned
+         */
+        unsigned partition_count() const;
+
+        /**
+         * @brief Find the HRIRs surrounding a point in the azimuth-elevation
+         * space and their interpolation weights
+         *
+         * @param point Azimuth and elevation in degrees
+         * @return HRIRWeights
+         */
+        HRIRWeights calculate_weights(const Vec2 &point) const;
+
+        /**
+         * @brief Find the HRIRs surrounding a sound source relative to the
+         * listener and their interpolation weights
+         *
+         * @param listener_position Position of the listener
+         * @param listener_rotation Rotation of the listener
+         * @param source_position   Position of the sound source
+         * @return HRIRWeights
+         */
+        HRIRWeights calculate_weights(const Vec3 &listener_position,
+                                      const Quaternion &listener_rotation,
+                                      const Vec3 &source_position) const;
+
+        /**
+         * @brief Interpolate the frequency-domain convolution partitions of
+         * the HRIR for a channel
+         *
+         * Since the Fourier transform is linear, this is equivalent to
+         * partitioning and transforming the interpolated time-domain HRIR.
+         *
+         * @param weights Interpolation weights
+         * @param channel Channel index
+         * @param dst     Destination buffer of partition_count() * BLOCK_BINS
+         * frequency bins
+         */
+        void calculate_HRIR_partitions(const HRIRWeights &weights, unsigned channel, Complex *dst) const;
+
         /**
          * @brief Calculate the head-related impulse response for a sound source
          * relative to the listener, applying interpolation as needed
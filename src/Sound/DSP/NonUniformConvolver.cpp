@@ -0,0 +1,90 @@
+#include <algorithm>
+
+#include <Math/Vectorize.hpp>
+#include <Sound/DSP/NonUniformConvolver.hpp>
+
+namespace Dynamo::Sound {
+    NonUniformConvolver::Segment::Segment(unsigned block_length) :
+        convolver(block_length), ratio(block_length / BLOCK_LENGTH) {
+        for (unsigned i = 0; i < 2; i++) {
+            inputs[i].resize(block_length, 0);
+            outputs[i].resize(block_length, 0);
+        }
+    }
+
+    NonUniformConvolver::NonUniformConvolver(ThreadPool *pool) : _clock(0), _pool(pool) {}
+
+    NonUniformConvolver::~NonUniformConvolver() { wait(); }
+
+    void NonUniformConvolver::wait() {
+        for (Segment &segment : _segments) {
+            if (segment.job.valid()) {
+                segment.job.wait();
+            }
+        }
+    }
+
+    void NonUniformConvolver::initialize(const WaveSample *ir, unsigned M) {
+        // Jobs reference the segments, so they must finish before resetting
+        wait();
+        _segments.clear();
+        _clock = 0;
+
+        // The head covers the impulse response up to the first tail segment
+        unsigned block_length = BLOCK_LENGTH << 1;
+        unsigned offset = std::min(M, block_length * 2);
+        _head = Convolver();
+        _head.initialize(ir, offset);
+
+        // Each segment of block length B covers [2B, 4B), except the last
+        // which covers the remainder of the impulse response
+        while (offset < M) {
+            unsigned length = M - offset;
+            if (block_length < MAX_BLOCK_LENGTH) {
+                length = std::min(length, block_length * 2);
+            }
+
+            Segment &segment = _segments.emplace_back(block_length);
+            segment.convolver.initialize(ir + offset, length);
+
+            offset += length;
+            block_length = std::min(block_length << 1, MAX_BLOCK_LENGTH);
+        }
+    }
+
+    void NonUniformConvolver::compute(WaveSample *src, WaveSample *dst, unsigned N) {
+        DYN_ASSERT(N <= BLOCK_LENGTH);
+        _head.compute(src, dst, N);
+
+        for (Segment &segment : _segments) {
+            unsigned block = _clock / segment.ratio;
+            unsigned slot = (_clock % segment.ratio) * BLOCK_LENGTH;
+            std::vector<WaveSample> &input = segment.inputs[block & 1];
+            std::vector<WaveSample> &output = segment.outputs[block & 1];
+
+            // Stage the input, zeroing out the remainder of the unit
+            std::copy(src, src + N, input.begin() + slot);
+            std::fill(input.begin() + slot + N, input.begin() + slot + BLOCK_LENGTH, 0);
+
+            // Mix in the output of the block that was completed 2 blocks ago
+            Vectorize::vadd(dst, output.data() + slot, dst, N);
+
+            // Compute the block once its input is complete, writing to the
+            // output buffer that has just been consumed
+            if (slot + BLOCK_LENGTH == input.size()) {
+                if (segment.job.valid()) {
+                    segment.job.get();
+                }
+                auto job = [&segment, &input, &output]() {
+                    segment.convolver.compute(input.data(), output.data(), input.size());
+                };
+                if (_pool) {
+                    segment.job = _pool->submit(job);
+                } else {
+                    job();
+                }
+            }
+        }
+        _clock++;
+    }
+} // namespace Dynamo::Sound
\ No newline at end of file
@@ -0,0 +1,143 @@
+#pragma once
+
+#include <array>
+#include <future>
+#include <vector>
+
+#include <Sound/Buffer.hpp>
+#include <Sound/DSP/Convolver.hpp>
+#include <Utils/ThreadPool.hpp>
+
+namespace Dynamo::Sound {
+    /**
+     * @brief Length of the largest subfilter unit for non-uniform
+     * convolutional processing
+     *
+     */
+    static constexpr unsigned MAX_BLOCK_LENGTH = BLOCK_LENGTH << 5;
+
+    /**
+     * @brief Signal convolution engine for long impulse responses
+     *
+     * The impulse response is split into segments of increasing block length
+     * (Gardner-style). The head segment uses the uniform BLOCK_LENGTH
+     * partitions and is computed in-line, so the latency is the same as
+     * Convolver. A segment of block length B starts at an offset of 2B into
+     * the impulse response, leaving a full block period to compute each of
+     * its blocks, optionally on a ThreadPool worker.
+     *
+     * Each call to compute() advances the signal by BLOCK_LENGTH samples.
+     *
+     */
+    class NonUniformConvolver {
+        /**
+         * @brief Tail segment of the impulse response
+         *
+         */
+        struct Segment {
+            /**
+             * @brief Uniform convolver of the segment
+             *
+             */
+            Convolver convolver;
+
+            /**
+             * @brief Number of BLOCK_LENGTH units per block
+             *
+             */
+            unsigned ratio;
+
+            /**
+             * @brief Double-buffered input blocks
+             *
+             */
+            std::array<std::vector<WaveSample>, 2> inputs;
+
+            /**
+             * @brief Double-buffered output blocks
+             *
+             */
+            std::array<std::vector<WaveSample>, 2> outputs;
+
+            /**
+             * @brief Pending block computation
+             *
+             */
+            std::future<void> job;
+
+            /**
+             * @brief Construct a new Segment object
+             *
+             * @param block_length Length of a subfilter unit
+             */
+            Segment(unsigned block_length);
+        };
+
+        /**
+         * @brief Convolver of the head segment
+         *
+         */
+        Convolver _head;
+
+        /**
+         * @brief Tail segments, ordered by block length
+         *
+         */
+        std::vector<Segment> _segments;
+
+        /**
+         * @brief Number of compute() calls since initialization
+         *
+         */
+        unsigned _clock;
+
+        /**
+         * @brief Thread pool for computing the tail segments
+         *
+         */
+        ThreadPool *_pool;
+
+        /**
+         * @brief Wait for all pending block computations
+         *
+         */
+        void wait();
+
+      public:
+        /**
+         * @brief Construct a new NonUniformConvolver object
+         *
+         * @param pool Thread pool for computing the tail segments, or nullptr
+         * to compute them in-line
+         */
+        NonUniformConvolver(ThreadPool *pool = nullptr);
+
+        /**
+         * @brief Destroy the NonUniformConvolver object
+         *
+         */
+        ~NonUniformConvolver();
+
+        NonUniformConvolver(const NonUniformConvolver &) = delete;
+        NonUniformConvolver &operator=(const NonUniformConvolver &) = delete;
+
+        /**
+         * @brief Set the impulse response to convolve
+         *
+         * This resets the convolution state.
+         *
+         * @param ir Impulse response buffer
+         * @param M  Length of the impulse response
+         */
+        void initialize(const WaveSample *ir, unsigned M);
+
+        /**
+         * @brief Apply the impulse response to a sound chunk
+         *
+         * @param src Source sound buffer
+         * @param dst Destination sound buffer
+         * @param N   Length of the sound, must be <= BLOCK_LENGTH
+         */
+        void compute(WaveSample *src, WaveSample *dst, unsigned N);
+    };
+} // namespace Dynamo::Sound
\ No newline at end of file
@@ -1,3 +1,10 @@
+#include <cmath>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <numeric>
+
+#include <Math/Vectorize.hpp>
 #include <Sound/DSP/Resample.hpp>
 
 namespace Dynamo::Sound {
@@ -63,4 +70,255 @@ namespace Dynamo::Sound {
             time += time_increment;
         }
     }
+
+    Resampler::Resampler(double src_rate, double dst_rate) :
+        _src_rate(src_rate), _dst_rate(dst_rate), _phases(0), _step(0) {
+        double factor = dst_rate / src_rate;
+        _scale = std::min(1.0, factor);
+        _filter_step = _scale * FILTER_PRECISION;
+
+        // Each wing reaches as far as the filter table, padded to a multiple
+        // of the vector width
+        _left = _filter_step ? (FILTER_HALF_LENGTH - 1) / _filter_step + 1 : FILTER_HALF_LENGTH;
+        _taps = (_left * 2 + 7) & ~7;
+
+        // Integer sample rates repeat a cycle of phases
+        if (std::floor(src_rate) == src_rate && std::floor(dst_rate) == dst_rate) {
+            unsigned long long src = src_rate;
+            unsigned long long dst = dst_rate;
+            unsigned long long divisor = std::gcd(src, dst);
+            if (dst / divisor <= MAX_RESAMPLE_PHASES) {
+                _phases = dst / divisor;
+                _step = src / divisor;
+            }
+        }
+
+        // Precompute the kernel of each phase
+        _kernels.resize(_phases * _taps);
+        for (unsigned p = 0; p < _phases; p++) {
+            compute_kernel(_scale * p / _phases, _kernels.data() + p * _taps);
+        }
+    }
+
+    void Resampler::compute_kernel(double P, float *kernel) const {
+        std::fill(kernel, kernel + _taps, 0);
+
+        // Left wing
+        double P_frac = P * FILTER_PRECISION;
+        unsigned l = P_frac;
+        double interp = P_frac - l;
+        for (unsigned i = 0; i < _left; i++) {
+            unsigned h_i = l + i * _filter_step;
+            if (h_i >= FILTER_HALF_LENGTH) break;
+            kernel[_left - 1 - i] = FILTER_RWING[h_i] + interp * FILTER_DIFFS[h_i];
+        }
+
+        // Right wing
+        P_frac = (_scale - P) * FILTER_PRECISION;
+        l = P_frac;
+        interp = P_frac - l;
+        for (unsigned i = 0; i < _left; i++) {
+            unsigned h_i = l + i * _filter_step;
+            if (h_i >= FILTER_HALF_LENGTH) break;
+            kernel[_left + i] = FILTER_RWING[h_i] + interp * FILTER_DIFFS[h_i];
+        }
+    }
+
+    const Resampler &Resampler::get(double src_rate, double dst_rate) {
+        static std::map<std::pair<double, double>, std::unique_ptr<Resampler>> resamplers;
+        static std::mutex mutex;
+
+        std::lock_guard<std::mutex> lock(mutex);
+        std::unique_ptr<Resampler> &resampler = resamplers[{src_rate, dst_rate}];
+        if (!resampler) {
+            resampler = std::make_unique<Resampler>(src_rate, dst_rate);
+        }
+        return *resampler;
+    }
+
+    unsigned Resampler::phases() const { return _phases; }
+
+    void Resampler::resample(const WaveSample *src, WaveSample *dst, double time_offset, double src_length) const {
+        double factor = _dst_rate / _src_rate;
+        double time_increment = 1.0 / factor;
+        unsigned dst_length = src_length * factor;
+
+        // Source frames past the end of the signal are treated as silence
+        long long src_end = std::ceil(src_length + time_offset);
+
+        // Use the precomputed kernels if the offset falls on a phase
+        double grid = time_offset * _phases;
+        unsigned long long position = std::llround(grid);
+        bool tabulated = _phases && std::abs(grid - position) < 1e-3;
+
+        std::array<float, MAX_RESAMPLE_TAPS + 8> kernel;
+        std::array<float, MAX_RESAMPLE_TAPS + 8> window;
+        for (unsigned dst_f = 0; dst_f < dst_length; dst_f++) {
+            // Get the source frame and the filter kernel
+            unsigned long long src_f;
+            const float *weights;
+            if (tabulated) {
+                unsigned long long q = position + static_cast<unsigned long long>(dst_f) * _step;
+                src_f = q / _phases;
+                weights = _kernels.data() + (q % _phases) * _taps;
+            } else {
+                double time = time_offset + dst_f * time_increment;
+                src_f = time;
+                compute_kernel(_scale * (time - src_f), kernel.data());
+                weights = kernel.data();
+            }
+
+            // Zero-pad the window of source frames at the boundaries
+            long long start = static_cast<long long>(src_f) - (_left - 1);
+            long long stop = start + _taps;
+            if (start >= 0 && stop <= src_end) {
+                dst[dst_f] = Vectorize::vdot(weights, src + start, _taps);
+            } else {
+                for (unsigned t = 0; t < _taps; t++) {
+                    long long s_i = start + t;
+                    window[t] = (s_i >= 0 && s_i < src_end) ? src[s_i] : 0;
+                }
+                dst[dst_f] = Vectorize::vdot(weights, window.data(), _taps);
+            }
+        }
+    }
+
+    StreamResampler::StreamResampler() :
+        _resampler(nullptr), _channels(0), _capacity(0), _length(0), _origin(0), _start(0), _tabulated(false),
+        _position(0), _output(0) {}
+
+    const float *StreamResampler::locate(unsigned long long dst_f, float *kernel, unsigned long long &src_f) const {
+        const Resampler &resampler = *_resampler;
+        if (_tabulated) {
+            unsigned long long q = _position + dst_f * resampler._step;
+            src_f = q / resampler._phases;
+            return resampler._kernels.data() + (q % resampler._phases) * resampler._taps;
+        }
+
+        // Same arithmetic as Resampler::resample()
+        double factor = resampler._dst_rate / resampler._src_rate;
+        double time_increment = 1.0 / factor;
+        double time = _start + dst_f * time_increment;
+        src_f = time;
+        resampler.compute_kernel(resampler._scale * (time - src_f), kernel);
+        return kernel;
+    }
+
+    long long StreamResampler::window_start(unsigned long long dst_f) const {
+        unsigned long long src_f;
+        if (_tabulated) {
+            src_f = (_position + dst_f * _resampler->_step) / _resampler->_phases;
+        } else {
+            double factor = _resampler->_dst_rate / _resampler->_src_rate;
+            double time_increment = 1.0 / factor;
+            src_f = _start + dst_f * time_increment;
+        }
+        return static_cast<long long>(src_f) - (_resampler->_left - 1);
+    }
+
+    void StreamResampler::reserve(unsigned length) {
+        if (_length + length <= _capacity) return;
+
+        // Grow each channel, keeping the pending frames
+        unsigned capacity = std::max(_capacity * 2, _length + length);
+        std::vector<WaveSample> frames(capacity * _channels);
+        for (unsigned c = 0; c < _channels; c++) {
+            const WaveSample *src = _frames.data() + c * _capacity;
+            std::copy(src, src + _length, frames.data() + c * capacity);
+        }
+        _frames = std::move(frames);
+        _capacity = capacity;
+    }
+
+    void StreamResampler::reset(const Resampler &resampler, unsigned channels, double start) {
+        _resampler = &resampler;
+        _channels = channels;
+        _start = start;
+        _output = 0;
+        _length = 0;
+
+        // Use the precomputed kernels if the start falls on a phase, as in
+        // Resampler::resample()
+        double grid = start * resampler._phases;
+        _position = std::llround(grid);
+        _tabulated = resampler._phases && std::abs(grid - _position) < 1e-3;
+
+        _origin = window_start(0);
+        _capacity = 0;
+        reserve(resampler._taps + MAX_RESAMPLE_TAPS);
+    }
+
+    const Resampler *StreamResampler::resampler() const { return _resampler; }
+
+    double StreamResampler::time() const {
+        if (_tabulated) {
+            return static_cast<double>(_position + _output * _resampler->_step) / _resampler->_phases;
+        }
+        double factor = _resampler->_dst_rate / _resampler->_src_rate;
+        double time_increment = 1.0 / factor;
+        return _start + _output * time_increment;
+    }
+
+    long long StreamResampler::next_frame() const { return _origin + _length; }
+
+    unsigned StreamResampler::required(unsigned frames) const {
+        if (frames == 0) return 0;
+        long long end = window_start(_output + frames - 1) + _resampler->_taps;
+        return std::max(end - next_frame(), 0ll);
+    }
+
+    unsigned StreamResampler::available() const {
+        unsigned frames = 0;
+        while (window_start(_output + frames) + _resampler->_taps <= next_frame()) {
+            frames++;
+        }
+        return frames;
+    }
+
+    void StreamResampler::write(const Buffer &src, unsigned offset, unsigned length) {
+        DYN_ASSERT(src.channels() == _channels);
+        reserve(length);
+        for (unsigned c = 0; c < _channels; c++) {
+            const WaveSample *frames = src[c] + offset;
+            std::copy(frames, frames + length, _frames.data() + c * _capacity + _length);
+        }
+        _length += length;
+    }
+
+    void StreamResampler::write_silence(unsigned length) {
+        reserve(length);
+        for (unsigned c = 0; c < _channels; c++) {
+            WaveSample *frames = _frames.data() + c * _capacity + _length;
+            std::fill(frames, frames + length, 0);
+        }
+        _length += length;
+    }
+
+    void StreamResampler::read(Buffer &dst, unsigned frames) {
+        DYN_ASSERT(required(frames) == 0);
+        DYN_ASSERT(dst.channels() >= _channels && dst.frames() >= frames);
+
+        std::array<float, MAX_RESAMPLE_TAPS + 8> kernel;
+        unsigned taps = _resampler->_taps;
+        for (unsigned i = 0; i < frames; i++) {
+            unsigned long long src_f;
+            const float *weights = locate(_output + i, kernel.data(), src_f);
+
+            // Apply the same kernel to each channel
+            long long start = static_cast<long long>(src_f) - (_resampler->_left - 1) - _origin;
+            for (unsigned c = 0; c < _channels; c++) {
+                dst[c][i] = Vectorize::vdot(weights, _frames.data() + c * _capacity + start, taps);
+            }
+        }
+        _output += frames;
+
+        // Discard the frames no longer covered by any kernel
+        unsigned drop = std::min<long long>(window_start(_output) - _origin, _length);
+        for (unsigned c = 0; c < _channels; c++) {
+            WaveSample *channel = _frames.data() + c * _capacity;
+            std::copy(channel + drop, channel + _length, channel);
+        }
+        _length -= drop;
+        _origin += drop;
+    }
 } // namespace Dynamo::Sound
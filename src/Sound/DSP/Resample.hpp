@@ -2,10 +2,20 @@
 #define _USE_MATH_DEFINES
 
 #include <array>
+#include <vector>
 
 #include <Sound/Buffer.hpp>
 
 namespace Dynamo::Sound {
+    /**
+     * @brief Version of the resampling filter.
+     *
+     * This must be incremented whenever the resampled output changes, which
+     * invalidates cached resampled sounds.
+     *
+     */
+    static constexpr unsigned RESAMPLER_VERSION = 1;
+
     /**
      * @brief Number of zero-crossings in the filter
      *
@@ -130,4 +140,279 @@ namespace Dynamo::Sound {
                          double src_length,
                          double src_rate,
                          double dst_rate);
+
+    /**
+     * @brief Maximum number of phases in a precomputed polyphase filter
+     * table
+     *
+     */
+    static constexpr unsigned MAX_RESAMPLE_PHASES = 1024;
+
+    /**
+     * @brief Maximum number of taps in a polyphase filter kernel
+     *
+     */
+    static constexpr unsigned MAX_RESAMPLE_TAPS = FILTER_HALF_LENGTH * 2;
+
+    /**
+     * @brief Polyphase sample rate converter
+     *
+     * This applies the same band-limited interpolation filter as
+     * resample_signal(), in single precision. When the ratio of the sample
+     * rates reduces to at most MAX_RESAMPLE_PHASES output phases (e.g.,
+     * 44.1kHz <-> 48kHz, 2x, 0.5x), the filter kernel of each phase is
+     * precomputed. Otherwise, the kernel of each output frame is computed on
+     * the fly.
+     *
+     */
+    class Resampler {
+        friend class StreamResampler;
+
+        double _src_rate;
+        double _dst_rate;
+
+        /**
+         * @brief Filter cutoff relative to the source Nyquist frequency
+         *
+         */
+        double _scale;
+
+        /**
+         * @brief Distance between successive taps in the filter table
+         *
+         */
+        unsigned _filter_step;
+
+        /**
+         * @brief Number of output frames in a cycle of phases, 0 if the
+         * kernels are not precomputed
+         *
+         */
+        unsigned _phases;
+
+        /**
+         * @brief Number of source frames in a cycle of phases
+         *
+         */
+        unsigned _step;
+
+        /**
+         * @brief Number of taps up to and including the current source frame
+         *
+         */
+        unsigned _left;
+
+        /**
+         * @brief Number of taps in a kernel, padded for vectorization
+         *
+         */
+        unsigned _taps;
+
+        /**
+         * @brief Filter kernel of each phase
+         *
+         */
+        std::vector<float> _kernels;
+
+        /**
+         * @brief Compute the filter kernel at an offset from a source frame
+         *
+         * @param P      Scaled offset from the source frame
+         * @param kernel Destination kernel of _taps weights
+         */
+        void compute_kernel(double P, float *kernel) const;
+
+      public:
+        /**
+         * @brief Construct a new Resampler object
+         *
+         * @param src_rate Source sample rate
+         * @param dst_rate Destination sample rate
+         */
+        Resampler(double src_rate, double dst_rate);
+
+        /**
+         * @brief Get the cached resampler for a pair of sample rates,
+         * building it on first use
+         *
+         * @param src_rate Source sample rate
+         * @param dst_rate Destination sample rate
+         * @return const Resampler&
+         */
+        static const Resampler &get(double src_rate, double dst_rate);
+
+        /**
+         * @brief Get the number of precomputed phases, 0 if the kernels are
+         * computed on the fly
+         *
+         * @return unsigned
+         */
+        unsigned phases() const;
+
+        /**
+         * @brief Change the sample rate of a signal
+         *
+         * This takes the same arguments as resample_signal().
+         *
+         * @param src         Signal source buffer
+         * @param dst         Signal destination buffer
+         * @param time_offset Frame offset in the signal source
+         * @param src_length  Length of the signal source
+         */
+        void resample(const WaveSample *src, WaveSample *dst, double time_offset, double src_length) const;
+    };
+
+    /**
+     * @brief Streaming sample rate converter for a single voice
+     *
+     * Source frames are written as they become available, and output frames
+     * are read in any number per call. The history and phase are kept between
+     * calls, so the output is identical to Resampler::resample() over the
+     * whole signal from the same start time.
+     *
+     */
+    class StreamResampler {
+        const Resampler *_resampler;
+        unsigned _channels;
+
+        /**
+         * @brief Pending source frames of each channel, _capacity apart
+         *
+         */
+        std::vector<WaveSample> _frames;
+        unsigned _capacity;
+        unsigned _length;
+
+        /**
+         * @brief Source frame index of the first pending frame
+         *
+         */
+        long long _origin;
+
+        /**
+         * @brief Source time of the first output frame
+         *
+         */
+        double _start;
+
+        /**
+         * @brief Whether the precomputed kernels are used, and the phase
+         * position of the first output frame
+         *
+         */
+        bool _tabulated;
+        unsigned long long _position;
+
+        /**
+         * @brief Number of output frames read
+         *
+         */
+        unsigned long long _output;
+
+        /**
+         * @brief Get the source frame of an output frame and its filter
+         * kernel
+         *
+         * @param dst_f  Index of the output frame
+         * @param kernel Workspace for kernels computed on the fly
+         * @param src_f  Destination source frame
+         * @return const float*
+         */
+        const float *locate(unsigned long long dst_f, float *kernel, unsigned long long &src_f) const;
+
+        /**
+         * @brief Get the first source frame covered by the kernel of an
+         * output frame
+         *
+         * @param dst_f Index of the output frame
+         * @return long long
+         */
+        long long window_start(unsigned long long dst_f) const;
+
+        /**
+         * @brief Make room for more pending source frames
+         *
+         * @param length Number of frames to append
+         */
+        void reserve(unsigned length);
+
+      public:
+        /**
+         * @brief Construct a new StreamResampler object
+         *
+         */
+        StreamResampler();
+
+        /**
+         * @brief Restart the stream, discarding pending frames
+         *
+         * @param resampler Sample rate converter
+         * @param channels  Number of channels
+         * @param start     Source time of the first output frame
+         */
+        void reset(const Resampler &resampler, unsigned channels, double start = 0);
+
+        /**
+         * @brief Get the sample rate converter, null if never reset
+         *
+         * @return const Resampler*
+         */
+        const Resampler *resampler() const;
+
+        /**
+         * @brief Get the source time of the next output frame
+         *
+         * @return double
+         */
+        double time() const;
+
+        /**
+         * @brief Get the index of the next source frame to be written,
+         * negative indices are before the start of the signal
+         *
+         * @return long long
+         */
+        long long next_frame() const;
+
+        /**
+         * @brief Get the number of source frames that must be written before
+         * reading output frames
+         *
+         * @param frames Number of output frames
+         * @return unsigned
+         */
+        unsigned required(unsigned frames) const;
+
+        /**
+         * @brief Get the number of output frames that can be read from the
+         * source frames written so far
+         *
+         * @return unsigned
+         */
+        unsigned available() const;
+
+        /**
+         * @brief Write source frames
+         *
+         * @param src    Source buffer with the same number of channels
+         * @param offset Frame offset in the source buffer
+         * @param length Number of frames
+         */
+        void write(const Buffer &src, unsigned offset, unsigned length);
+
+        /**
+         * @brief Write silent source frames, e.g., past the end of the signal
+         *
+         * @param length Number of frames
+         */
+        void write_silence(unsigned length);
+
+        /**
+         * @brief Read output frames, after writing the required source frames
+         *
+         * @param dst    Destination buffer with at least as many channels
+         * @param frames Number of output frames
+         */
+        void read(Buffer &dst, unsigned frames);
+    };
 } // namespace Dynamo::Sound
\ No newline at end of file
@@ -3,8 +3,19 @@
 
 namespace Dynamo::Sound {
     void Binaural::apply(const Buffer &src, Buffer &dst, const Source &source, const Listener &listener) {
-        _impulse_response.resize(HRIR_LENGTH, 2);
-        _hrtf.calculate_HRIR(listener.position, listener.rotation, source.position, _impulse_response);
+        const HRTF &hrtf = HRTF::get();
+        HRIRWeights weights = hrtf.calculate_weights(listener.position, listener.rotation, source.position);
+
+        // Only recompute the impulse responses if the interpolation changed
+        if (!_weights.has_value() || _weights.value() != weights) {
+            unsigned partition_length = hrtf.partition_count() * BLOCK_BINS;
+            _partitions.resize(2 * partition_length);
+            for (unsigned c = 0; c < 2; c++) {
+                hrtf.calculate_HRIR_partitions(weights, c, _partitions.data() + c * partition_length);
+            }
+            _convolver.initialize(_partitions.data(), hrtf.partition_count(), 2);
+            _weights = weights;
+        }
 
         // Downmix the source buffer to mono
         _mono.resize(src.frames(), 1);
@@ -14,12 +25,7 @@ namespace Dynamo::Sound {
         // Resize the destination buffer
         dst.resize(src.frames(), 2);
 
-        // Initialize channel convolvers
-        _convolvers[0].initialize(_impulse_response[0], _impulse_response.frames());
-        _convolvers[1].initialize(_impulse_response[1], _impulse_response.frames());
-
-        // Apply convolution
-        _convolvers[0].compute(_mono[0], dst[0], src.frames());
-        _convolvers[1].compute(_mono[0], dst[1], src.frames());
+        // Apply convolution for both ears with a shared input transform
+        _convolver.compute(_mono[0], dst, src.frames());
     }
 } // namespace Dynamo::Sound
\ No newline at end of file
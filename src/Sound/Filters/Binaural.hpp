@@ -1,6 +1,7 @@
 #pragma once
 
-#include <array>
+#include <optional>
+#include <vector>
 
 #include <Sound/DSP/Convolver.hpp>
 #include <Sound/DSP/HRTF.hpp>
@@ -12,10 +13,10 @@ namespace Dynamo::Sound {
      *
      */
     class Binaural : public Filter {
-        HRTF _hrtf;
-        std::array<Convolver, 2> _convolvers;
+        Convolver _convolver;
 
-        Buffer _impulse_response;
+        std::optional<HRIRWeights> _weights;
+        std::vector<Complex> _partitions;
         Buffer _mono;
 
       public:
@@ -1,18 +1,31 @@
 #include <Math/Vectorize.hpp>
+#include <Sound/DSP/Ambisonics.hpp>
 #include <Sound/DSP/Resample.hpp>
 #include <Sound/Jukebox.hpp>
 #include <Sound/Listener.hpp>
 
 namespace Dynamo::Sound {
-    Jukebox::Jukebox() {
+    Jukebox::Jukebox(unsigned mix_threads) {
         // Initialize state
+        _offline = false;
         _input_stream = nullptr;
         _input_state.channels = 0;
+        _input_state.high_water = 0;
+        _input_state.low_water = 0;
 
         _output_stream = nullptr;
         _output_state.channels = 0;
+        _output_state.high_water = 0;
+        _output_state.low_water = 0;
 
         _volume = 1.0f;
+        _resampler = nullptr;
+        _composite_resampling = false;
+        _composite_offset = 0;
+
+        if (mix_threads > 0) {
+            _pool = std::make_unique<ThreadPool>(mix_threads);
+        }
 
         // Initialize PortAudio
         PaError err;
@@ -41,7 +54,34 @@ namespace Dynamo::Sound {
         }
     }
 
+    Jukebox::Jukebox(const OfflineOutput &output, unsigned mix_threads) {
+        // Initialize state
+        _offline = true;
+        _input_stream = nullptr;
+        _input_state.channels = 0;
+        _input_state.high_water = 0;
+        _input_state.low_water = 0;
+
+        _output_stream = nullptr;
+        _output_state.channels = output.channels;
+        _output_state.sample_rate = output.sample_rate;
+        _output_state.high_water = 0;
+        _output_state.low_water = 0;
+
+        _volume = 1.0f;
+        _resampler = &Resampler::get(STANDARD_SAMPLE_RATE, output.sample_rate);
+        _composite_resampling = false;
+
+        _composite.resize(MAX_CHUNK_LENGTH, output.channels);
+        _composite_offset = _composite.frames();
+
+        if (mix_threads > 0) {
+            _pool = std::make_unique<ThreadPool>(mix_threads);
+        }
+    }
+
     Jukebox::~Jukebox() {
+        if (_offline) return;
         PaError err;
 
         // Close the IO streams
@@ -72,7 +112,13 @@ namespace Dynamo::Sound {
                                 PaStreamCallbackFlags status_flags,
                                 void *data) {
         PaState *state = static_cast<PaState *>(data);
-        state->buffer.write(static_cast<const WaveSample *>(input), frame_count * state->channels);
+        record_callback(*state, status_flags & paInputUnderflow, status_flags & paInputOverflow);
+
+        // Count the callback if the mixer fell behind and samples were dropped
+        unsigned length = frame_count * state->channels;
+        if (state->buffer.write(static_cast<const WaveSample *>(input), length) < length) {
+            state->xruns.fetch_add(1, std::memory_order_relaxed);
+        }
         return 0;
     }
 
@@ -83,54 +129,165 @@ namespace Dynamo::Sound {
                                  PaStreamCallbackFlags status_flags,
                                  void *data) {
         PaState *state = static_cast<PaState *>(data);
-        state->buffer.read(static_cast<WaveSample *>(output), frame_count * state->channels);
+        WaveSample *samples = static_cast<WaveSample *>(output);
+        unsigned length = frame_count * state->channels;
+        record_callback(*state, status_flags & paOutputUnderflow, status_flags & paOutputOverflow);
+
+        // Bin the fill level the mixer kept ahead of the device
+        unsigned size = state->buffer.size();
+        unsigned bin = std::min(size * FILL_HISTOGRAM_BINS / std::max(state->high_water, 1u), FILL_HISTOGRAM_BINS - 1);
+        state->fill_histogram[bin].fetch_add(1, std::memory_order_relaxed);
+
+        // Silence any samples the mixer could not provide in time
+        unsigned read = state->buffer.read(samples, length);
+        std::fill(samples + read, samples + length, 0);
+        if (read < length) {
+            state->xruns.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // Wake the mixer if the buffer is running low
+        //
+        // The lock is not held so the callback never blocks. A missed wakeup
+        // is recovered on the next callback, which the low-water margin covers.
+        if (state->buffer.size() < state->low_water) {
+            state->demand.notify_one();
+        }
         return 0;
     }
 
-    void Jukebox::process_source(Source &source) {
-        // Calculate the number of frames in the destination buffer
-        Buffer &buffer = source._buffer;
-        double frame_stop = std::min(source._frame + MAX_CHUNK_LENGTH, static_cast<double>(buffer.frames()));
-        double frames = frame_stop - source._frame;
+    void Jukebox::record_callback(PaState &state, bool underflow, bool overflow) {
+        state.callbacks.fetch_add(1, std::memory_order_relaxed);
+        if (underflow) state.underflow_flags.fetch_add(1, std::memory_order_relaxed);
+        if (overflow) state.overflow_flags.fetch_add(1, std::memory_order_relaxed);
+
+        // Accumulate the interval since the previous callback of the stream
+        std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        if (state.last_callback != std::chrono::steady_clock::time_point()) {
+            auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(now - state.last_callback);
+            unsigned long long interval = elapsed.count();
+            state.interval_count.fetch_add(1, std::memory_order_relaxed);
+            state.interval_sum.fetch_add(interval, std::memory_order_relaxed);
+            state.interval_square_sum.fetch_add(interval * interval, std::memory_order_relaxed);
+            if (interval > state.interval_max.load(std::memory_order_relaxed)) {
+                state.interval_max.store(interval, std::memory_order_relaxed);
+            }
+        }
+        state.last_callback = now;
+    }
+
+    void Jukebox::record_mix(std::chrono::steady_clock::time_point start) {
+        auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+        unsigned long long mix_time = elapsed.count();
+
+        // Publish the record between odd and even sequence numbers
+        unsigned long long sequence = _mix_sequence.load(std::memory_order_relaxed);
+        _mix_sequence.store(sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        _mix_time.store(mix_time, std::memory_order_relaxed);
+        _mix_time_sum.fetch_add(mix_time, std::memory_order_relaxed);
+        _mix_count.fetch_add(1, std::memory_order_relaxed);
+        _mix_sequence.store(sequence + 2, std::memory_order_release);
+
+        unsigned long long mix_time_max = _mix_time_max.load(std::memory_order_relaxed);
+        while (mix_time > mix_time_max &&
+               !_mix_time_max.compare_exchange_weak(mix_time_max, mix_time, std::memory_order_relaxed)) {
+        }
+    }
 
-        // Calculate the number of frames required to process
-        double factor = STANDARD_SAMPLE_RATE / _output_state.sample_rate;
-        double length = frames * factor;
+    void Jukebox::process_source(Source &source, MixContext &context) {
+        unsigned frames = source.frames();
+        unsigned channels = source.channels();
+
+        Buffer &scratch = context.scratch;
+        scratch.resize(MAX_CHUNK_LENGTH, channels);
+
+        if (_composite_resampling) {
+            // Copy the chunk at the engine sample rate, silent past the end
+            // of the buffer
+            unsigned begin = std::min(static_cast<unsigned>(source._frame), frames);
+            unsigned inside = std::min(frames - begin, MAX_CHUNK_LENGTH);
+            source.read(scratch, begin, inside);
+            for (unsigned c = 0; c < channels; c++) {
+                std::fill(scratch[c] + inside, scratch[c] + MAX_CHUNK_LENGTH, 0);
+            }
+            source._frame = static_cast<double>(begin) + MAX_CHUNK_LENGTH;
+        } else {
+            StreamResampler &stream = source._stream;
 
-        // Resample to the device sample rate
-        _scratch.resize(frames, buffer.channels());
-        for (unsigned c = 0; c < buffer.channels(); c++) {
-            resample_signal(buffer[c],
-                            _scratch[c],
-                            source._frame,
-                            length,
-                            STANDARD_SAMPLE_RATE,
-                            _output_state.sample_rate);
+            // Restart the stream if the source was seeked or the device changed
+            if (stream.resampler() != _resampler || stream.time() != source._frame) {
+                stream.reset(*_resampler, channels, source._frame);
+            }
+
+            // Write the source frames needed for the chunk, silent outside of
+            // the buffer
+            unsigned required = stream.required(MAX_CHUNK_LENGTH);
+            long long begin = stream.next_frame();
+            long long end = begin + required;
+            unsigned before = std::clamp(-begin, 0ll, static_cast<long long>(required));
+            unsigned inside = std::max(std::min(end, static_cast<long long>(frames)) - std::max(begin, 0ll), 0ll);
+            stream.write_silence(before);
+            if (source.resident()) {
+                stream.write(source._buffer, begin + before, inside);
+            } else {
+                // Decode the compact or streamed clip chunk by chunk
+                Buffer &decoded = context.decoded;
+                decoded.resize(inside, channels);
+                source.read(decoded, begin + before, inside);
+                stream.write(decoded, 0, inside);
+            }
+            stream.write_silence(required - before - inside);
+
+            // Resample to the device sample rate
+            stream.read(scratch, MAX_CHUNK_LENGTH);
+            source._frame = stream.time();
         }
 
         // Apply the filters
         if (source._filter.has_value()) {
             Filter &filter = source._filter.value();
-            filter.apply(_scratch, _scratch, source, _listener);
+            filter.apply(scratch, scratch, source, _listener);
         }
 
-        // Remix to the output device channels
-        _remixed.resize(_scratch.frames(), _output_state.channels);
-        _remixed.silence();
-        _scratch.remix(_remixed);
+        // Encode into the ambisonic bus by the direction of the source
+        if (_ambisonics && source._ambisonic) {
+            Buffer &mono = context.remixed;
+            mono.resize(scratch.frames(), 1);
+            mono.silence();
+            scratch.remix(mono);
+
+            std::array<float, ambisonic_channels(MAX_AMBISONIC_ORDER)> coefficients = {1};
+            Vec3 direction = source.position - _listener.position;
+            if (direction.length_squared() > 0) {
+                encode_ambisonic(direction / direction.length(), _ambisonics->order(), coefficients.data());
+            }
 
-        // Mix the processed sound onto the composite signal
-        for (unsigned c = 0; c < _composite.channels(); c++) {
-            Vectorize::vsma(_remixed[c], _volume, _composite[c], _remixed.frames());
+            Buffer &bus = context.bus;
+            for (unsigned c = 0; c < bus.channels(); c++) {
+                Vectorize::vsma(mono[0], coefficients[c] * _volume, bus[c], mono.frames());
+            }
+            return;
         }
 
-        // Advance chunk frame
-        source._frame += length;
+        // Remix to the output device channels
+        Buffer &remixed = context.remixed;
+        remixed.resize(scratch.frames(), _output_state.channels);
+        remixed.silence();
+        scratch.remix(remixed);
+
+        // Mix the processed sound onto the group composite signal
+        Buffer &composite = context.composite;
+        for (unsigned c = 0; c < composite.channels(); c++) {
+            Vectorize::vsma(remixed[c], _volume, composite[c], remixed.frames());
+        }
     }
 
     Listener &Jukebox::listener() { return _listener; }
 
     const std::vector<Device> &Jukebox::devices() {
+        // An offline Jukebox has no devices
+        if (_offline) return _devices;
+
         PaError err;
 
         // Count the devices
@@ -170,6 +327,7 @@ namespace Dynamo::Sound {
 
         // Update internal state
         _input_state.channels = device.input_channels;
+        _input_state.last_callback = {};
 
         // Open and start the stream
         PaStreamParameters params;
@@ -213,6 +371,12 @@ namespace Dynamo::Sound {
             }
         }
 
+        // Pace the mixer to keep a bounded number of chunks queued
+        unsigned chunk_length = MAX_CHUNK_LENGTH * device.output_channels;
+        _output_state.high_water = std::min(MIX_AHEAD_CHUNKS * chunk_length, BUFFER_SIZE);
+        _output_state.low_water = std::min(MIX_WAKE_CHUNKS * chunk_length, _output_state.high_water);
+        _output_state.last_callback = {};
+
         // Open and start the stream
         PaStreamParameters params;
         params.channelCount = device.output_channels;
@@ -246,14 +410,44 @@ namespace Dynamo::Sound {
 
         // Update internal state
         _output_state.sample_rate = info->sampleRate;
+        _resampler = &Resampler::get(STANDARD_SAMPLE_RATE, _output_state.sample_rate);
         _output_state.channels = device.output_channels;
         _composite.resize(MAX_CHUNK_LENGTH, device.output_channels);
+        if (_composite_resampling) {
+            reset_composite_stream();
+        }
     }
 
     void Jukebox::set_volume(float volume) { _volume = std::clamp(volume, 0.0f, 1.0f); }
 
     float Jukebox::get_volume() const { return _volume; }
 
+    void Jukebox::set_composite_resampling(bool enabled) {
+        _composite_resampling_request.store(enabled, std::memory_order_relaxed);
+    }
+
+    bool Jukebox::get_composite_resampling() const {
+        return _composite_resampling_request.load(std::memory_order_relaxed);
+    }
+
+    void Jukebox::set_ambisonic_order(unsigned order) {
+        if (order > MAX_AMBISONIC_ORDER) {
+            Log::error("Jukebox ambisonic order {} is higher than the maximum {}.", order, MAX_AMBISONIC_ORDER);
+        }
+        if (order == get_ambisonic_order()) return;
+
+        // Build the decoder here, as the HRIRs are too slow to load while mixing
+        std::unique_ptr<AmbisonicDecoder> decoder = order ? std::make_unique<AmbisonicDecoder>(order) : nullptr;
+        {
+            std::lock_guard<std::mutex> lock(_ambisonics_mutex);
+            std::swap(decoder, _ambisonics_request);
+            _ambisonics_changed = true;
+            _ambisonic_order.store(order, std::memory_order_relaxed);
+        }
+    }
+
+    unsigned Jukebox::get_ambisonic_order() const { return _ambisonic_order.load(std::memory_order_relaxed); }
+
     bool Jukebox::is_playing() { return _output_stream != nullptr && Pa_IsStreamActive(_output_stream); }
 
     bool Jukebox::is_recording() { return _input_stream != nullptr && Pa_IsStreamActive(_input_stream); }
@@ -280,21 +474,150 @@ namespace Dynamo::Sound {
         }
     }
 
-    void Jukebox::resume() { Pa_StartStream(_output_stream); }
+    void Jukebox::resume() {
+        if (_output_stream) Pa_StartStream(_output_stream);
+    }
+
+    void Jukebox::pause() {
+        if (_output_stream) Pa_StopStream(_output_stream);
+
+        // Do not count the pause as a callback interval
+        _output_state.last_callback = {};
+    }
 
-    void Jukebox::pause() { Pa_StopStream(_output_stream); }
+    JukeboxStats Jukebox::stats() const {
+        JukeboxStats stats;
+        stats.output_callbacks = _output_state.callbacks.load(std::memory_order_relaxed);
+        stats.output_underruns = _output_state.xruns.load(std::memory_order_relaxed);
+        stats.output_overruns = _output_overruns.load(std::memory_order_relaxed);
+        stats.input_callbacks = _input_state.callbacks.load(std::memory_order_relaxed);
+        stats.input_overruns = _input_state.xruns.load(std::memory_order_relaxed);
+        stats.output_underflow_flags = _output_state.underflow_flags.load(std::memory_order_relaxed);
+        stats.output_overflow_flags = _output_state.overflow_flags.load(std::memory_order_relaxed);
+        stats.input_underflow_flags = _input_state.underflow_flags.load(std::memory_order_relaxed);
+        stats.input_overflow_flags = _input_state.overflow_flags.load(std::memory_order_relaxed);
+        for (unsigned i = 0; i < FILL_HISTOGRAM_BINS; i++) {
+            stats.fill_histogram[i] = _output_state.fill_histogram[i].load(std::memory_order_relaxed);
+        }
+
+        // Mean and standard deviation of the callback intervals
+        double count = _output_state.interval_count.load(std::memory_order_relaxed);
+        double sum = _output_state.interval_sum.load(std::memory_order_relaxed);
+        double square_sum = _output_state.interval_square_sum.load(std::memory_order_relaxed);
+        double mean = count ? sum / count : 0;
+        double variance = count ? std::max(square_sum / count - mean * mean, 0.0) : 0;
+        stats.callback_interval = Seconds(mean * 1e-6);
+        stats.callback_jitter = Seconds(std::sqrt(variance) * 1e-6);
+        stats.callback_interval_max = Seconds(_output_state.interval_max.load(std::memory_order_relaxed) * 1e-6);
+
+        // Retry while the mixing thread is recording an update
+        unsigned long long sequence, mix_count, mix_time, mix_time_sum;
+        do {
+            sequence = _mix_sequence.load(std::memory_order_acquire);
+            mix_count = _mix_count.load(std::memory_order_relaxed);
+            mix_time = _mix_time.load(std::memory_order_relaxed);
+            mix_time_sum = _mix_time_sum.load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+        } while ((sequence & 1) || sequence != _mix_sequence.load(std::memory_order_relaxed));
+        stats.mix_time = Seconds(mix_time * 1e-9);
+        stats.mix_time_mean = Seconds(mix_count ? mix_time_sum * 1e-9 / mix_count : 0);
+        stats.mix_time_max = Seconds(_mix_time_max.load(std::memory_order_relaxed) * 1e-9);
+        return stats;
+    }
 
     void Jukebox::update() {
-        // Wait for there to be available space in the buffer
-        unsigned min_length = MAX_CHUNK_LENGTH * _output_state.channels;
-        if (_output_state.buffer.remaining() < min_length || !is_playing()) {
-            return;
+        if (!is_playing()) return;
+        apply_settings();
+
+        // Mix chunks until the output buffer reaches its high-water mark
+        //
+        // A resampled composite chunk can hold a few more frames than the
+        // engine rate chunk it was mixed from.
+        unsigned chunk_frames = MAX_CHUNK_LENGTH;
+        if (_composite_resampling) {
+            chunk_frames = std::ceil(MAX_CHUNK_LENGTH * _output_state.sample_rate / STANDARD_SAMPLE_RATE) + 1;
+        }
+        unsigned chunk_length = chunk_frames * _output_state.channels;
+        if (_output_state.buffer.size() + chunk_length > _output_state.high_water) return;
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        while (_output_state.buffer.size() + chunk_length <= _output_state.high_water) {
+            mix_chunk();
+        }
+        record_mix(start);
+    }
+
+    void Jukebox::render(Buffer &dst, unsigned frames) {
+        DYN_ASSERT(_offline);
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        apply_settings();
+        unsigned channels = _output_state.channels;
+        dst.resize(frames, channels);
+
+        // Copy the composite one chunk at a time, mixing as needed
+        unsigned frame = 0;
+        while (frame < frames) {
+            if (_composite_offset == _composite.frames()) {
+                mix_chunk();
+                _composite_offset = 0;
+            }
+
+            unsigned length = std::min(frames - frame, _composite.frames() - _composite_offset);
+            for (unsigned c = 0; c < channels; c++) {
+                const WaveSample *samples = _composite[c] + _composite_offset;
+                std::copy(samples, samples + length, dst[c] + frame);
+            }
+            _composite_offset += length;
+            frame += length;
         }
+        record_mix(start);
+    }
+
+    void Jukebox::wait(Seconds timeout) {
+        std::unique_lock<std::mutex> lock(_output_state.mutex);
+        _output_state.demand.wait_for(lock, timeout, [this]() {
+            return is_playing() && _output_state.buffer.size() < _output_state.low_water;
+        });
+    }
+
+    void Jukebox::reset_composite_stream() {
+        // Start with silence to the left of the first engine frame
+        _composite_stream.reset(*_resampler, _output_state.channels);
+        _composite_stream.write_silence(-_composite_stream.next_frame());
+    }
 
-        // Zero-out the composite waveform
-        _composite.silence();
+    void Jukebox::apply_settings() {
+        bool composite_resampling = _composite_resampling_request.load(std::memory_order_relaxed);
+        if (composite_resampling && !_composite_resampling && _resampler) {
+            reset_composite_stream();
+        }
+        _composite_resampling = composite_resampling;
+
+        std::lock_guard<std::mutex> lock(_ambisonics_mutex);
+        if (_ambisonics_changed) {
+            std::swap(_ambisonics, _ambisonics_request);
+            _ambisonics_changed = false;
+        }
+    }
+
+    void Jukebox::process_group(unsigned group) {
+        MixContext &context = _contexts[group];
+        context.composite.resize(MAX_CHUNK_LENGTH, _output_state.channels);
+        context.composite.silence();
+        if (_ambisonics) {
+            context.bus.resize(MAX_CHUNK_LENGTH, _ambisonics->channels());
+            context.bus.silence();
+        }
 
-        // Process chunks and mix onto the composite
+        unsigned start = group * MIX_GROUP_SIZE;
+        unsigned stop = std::min(start + MIX_GROUP_SIZE, static_cast<unsigned>(_sources.size()));
+        for (unsigned i = start; i < stop; i++) {
+            process_source(_sources[i], context);
+        }
+    }
+
+    void Jukebox::mix_chunk() {
+        // Remove finished sources
         auto d_it = _sources.begin();
         while (d_it != _sources.end()) {
             Source &source = *d_it;
@@ -303,21 +626,101 @@ namespace Dynamo::Sound {
                 source._playing = false;
                 source._on_finish();
             } else {
-                process_source(source);
                 d_it++;
             }
         }
 
+        // Partition the sources into groups, each with private buffers
+        unsigned groups = (_sources.size() + MIX_GROUP_SIZE - 1) / MIX_GROUP_SIZE;
+
+        // Keep decoding the ambisonic bus without sources, so the HRIR tails
+        // drain and no stale history is convolved into the next source
+        if (_ambisonics) {
+            groups = std::max(groups, 1u);
+        }
+        if (_contexts.size() < groups) {
+            _contexts.resize(groups);
+        }
+
+        // Process chunks and mix onto the group composites
+        if (_pool && groups > 1) {
+            _jobs.clear();
+            for (unsigned g = 0; g < groups; g++) {
+                _jobs.emplace_back(_pool->submit([this, g]() { process_group(g); }));
+            }
+            for (std::future<void> &job : _jobs) {
+                job.get();
+            }
+        } else {
+            for (unsigned g = 0; g < groups; g++) {
+                process_group(g);
+            }
+        }
+
+        // Pairwise tree reduction of the group composites in a fixed order
+        for (unsigned stride = 1; stride < groups; stride <<= 1) {
+            for (unsigned g = 0; g + stride < groups; g += stride << 1) {
+                Buffer &dst = _contexts[g].composite;
+                const Buffer &src = _contexts[g + stride].composite;
+                for (unsigned c = 0; c < dst.channels(); c++) {
+                    Vectorize::vadd(dst[c], src[c], dst[c], dst.frames());
+                }
+                if (_ambisonics) {
+                    Buffer &dst_bus = _contexts[g].bus;
+                    const Buffer &src_bus = _contexts[g + stride].bus;
+                    for (unsigned c = 0; c < dst_bus.channels(); c++) {
+                        Vectorize::vadd(dst_bus[c], src_bus[c], dst_bus[c], dst_bus.frames());
+                    }
+                }
+            }
+        }
+
+        // Decode the ambisonic bus once for all sources
+        if (_ambisonics) {
+            _ambisonics->decode(_contexts[0].bus, _binaural, _listener.rotation);
+            _binaural_remixed.resize(_binaural.frames(), _output_state.channels);
+            _binaural_remixed.silence();
+            _binaural.remix(_binaural_remixed);
+
+            Buffer &composite = _contexts[0].composite;
+            for (unsigned c = 0; c < composite.channels(); c++) {
+                Vectorize::vadd(_binaural_remixed[c], composite[c], composite[c], composite.frames());
+            }
+        }
+
+        // Write the reduced groups onto the composite waveform
+        if (_composite_resampling) {
+            // Resample the engine rate mix to the device sample rate
+            if (groups > 0) {
+                _composite_stream.write(_contexts[0].composite, 0, MAX_CHUNK_LENGTH);
+            } else {
+                _composite_stream.write_silence(MAX_CHUNK_LENGTH);
+            }
+            unsigned frames = _composite_stream.available();
+            _composite.resize(frames, _output_state.channels);
+            _composite_stream.read(_composite, frames);
+        } else if (groups > 0) {
+            const Buffer &reduced = _contexts[0].composite;
+            _composite.resize(MAX_CHUNK_LENGTH, _output_state.channels);
+            std::copy(reduced.data(), reduced.data() + reduced.frames() * reduced.channels(), _composite.data());
+        } else {
+            _composite.resize(MAX_CHUNK_LENGTH, _output_state.channels);
+            _composite.silence();
+        }
+
         // Clamp channels
         for (unsigned c = 0; c < _composite.channels(); c++) {
             Vectorize::vclamp(_composite[c], -1, 1, _composite[c], _composite.frames());
         }
 
+        // Offline renders read the composite directly
+        if (_offline) return;
+
         // Interleave the composite and write to the ring buffer
-        for (unsigned f = 0; f < _composite.frames(); f++) {
-            for (unsigned c = 0; c < _composite.channels(); c++) {
-                _output_state.buffer.write(_composite[c][f]);
-            }
+        _interleaved.resize(_composite.frames() * _composite.channels());
+        Vectorize::interleave(_composite.data(), _interleaved.data(), _composite.channels(), _composite.frames());
+        if (_output_state.buffer.write(_interleaved.data(), _interleaved.size()) < _interleaved.size()) {
+            _output_overruns.fetch_add(1, std::memory_order_relaxed);
         }
     }
 } // namespace Dynamo::Sound
\ No newline at end of file
@@ -1,12 +1,21 @@
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <memory>
+#include <mutex>
 #include <vector>
 
 #include <portaudio.h>
 
 #include <Utils/RingBuffer.hpp>
+#include <Utils/ThreadPool.hpp>
 
 #include <Sound/Buffer.hpp>
+#include <Sound/DSP/Resample.hpp>
 #include <Sound/Device.hpp>
 #include <Sound/Listener.hpp>
 #include <Sound/Source.hpp>
@@ -30,6 +39,145 @@ namespace Dynamo::Sound {
      */
     static constexpr unsigned BUFFER_SIZE = MAX_CHUNK_LENGTH * 64;
 
+    /**
+     * @brief Number of chunks the mixer keeps queued ahead of the output
+     * device.
+     *
+     * This bounds the output latency to at most this many chunks.
+     *
+     */
+    static constexpr unsigned MIX_AHEAD_CHUNKS = 8;
+
+    /**
+     * @brief Number of queued chunks below which the output device wakes the
+     * mixer.
+     *
+     */
+    static constexpr unsigned MIX_WAKE_CHUNKS = 4;
+
+    /**
+     * @brief Number of sources mixed sequentially by a single mixing job.
+     *
+     * Sources are grouped the same way regardless of the number of mixing
+     * threads, so the summation order (and the output) is deterministic.
+     *
+     */
+    static constexpr unsigned MIX_GROUP_SIZE = 16;
+
+    class AmbisonicDecoder;
+
+    /**
+     * @brief Number of bins of the output buffer fill level histogram.
+     *
+     */
+    static constexpr unsigned FILL_HISTOGRAM_BINS = 8;
+
+    /**
+     * @brief Snapshot of the Jukebox timing and buffer instrumentation.
+     *
+     */
+    struct JukeboxStats {
+        /**
+         * @brief Number of output device callbacks.
+         *
+         */
+        unsigned long long output_callbacks;
+
+        /**
+         * @brief Number of output callbacks that played silence because the
+         * mixer did not provide enough samples in time.
+         *
+         */
+        unsigned long long output_underruns;
+
+        /**
+         * @brief Number of mixed chunks that did not fit in the output
+         * buffer and were partially dropped.
+         *
+         */
+        unsigned long long output_overruns;
+
+        /**
+         * @brief Number of input device callbacks.
+         *
+         */
+        unsigned long long input_callbacks;
+
+        /**
+         * @brief Number of input callbacks whose samples did not fit in the
+         * input buffer and were partially dropped.
+         *
+         */
+        unsigned long long input_overruns;
+
+        /**
+         * @brief Number of callbacks PortAudio flagged with paOutputUnderflow,
+         * paOutputOverflow, paInputUnderflow and paInputOverflow.
+         *
+         */
+        unsigned long long output_underflow_flags;
+        unsigned long long output_overflow_flags;
+        unsigned long long input_underflow_flags;
+        unsigned long long input_overflow_flags;
+
+        /**
+         * @brief Mean time between output callbacks.
+         *
+         */
+        Seconds callback_interval;
+
+        /**
+         * @brief Standard deviation of the time between output callbacks.
+         *
+         */
+        Seconds callback_jitter;
+
+        /**
+         * @brief Longest time between output callbacks.
+         *
+         */
+        Seconds callback_interval_max;
+
+        /**
+         * @brief Time spent mixing by the last update that mixed any chunks.
+         *
+         */
+        Seconds mix_time;
+
+        /**
+         * @brief Mean and longest time spent mixing by an update.
+         *
+         */
+        Seconds mix_time_mean;
+        Seconds mix_time_max;
+
+        /**
+         * @brief Number of output callbacks by the fill level of the output
+         * buffer, in equal bins up to the high-water mark.
+         *
+         */
+        std::array<unsigned long long, FILL_HISTOGRAM_BINS> fill_histogram;
+    };
+
+    /**
+     * @brief Output format of a Jukebox that renders offline instead of to an
+     * output device.
+     *
+     */
+    struct OfflineOutput {
+        /**
+         * @brief Number of output channels.
+         *
+         */
+        unsigned channels;
+
+        /**
+         * @brief Output sample rate.
+         *
+         */
+        double sample_rate;
+    };
+
     /**
      * @brief Audio engine supporting sound spatialization.
      *
@@ -38,11 +186,80 @@ namespace Dynamo::Sound {
         PaStream *_input_stream;
         PaStream *_output_stream;
 
+        /**
+         * @brief Render into buffers on demand without PortAudio.
+         *
+         */
+        bool _offline;
+
         float _volume;
 
-        Buffer _scratch;
-        Buffer _remixed;
+        /**
+         * @brief Private working buffers for a group of sources.
+         *
+         */
+        struct MixContext {
+            Buffer decoded;
+            Buffer scratch;
+            Buffer remixed;
+            Buffer composite;
+            Buffer bus;
+        };
+        std::vector<MixContext> _contexts;
         Buffer _composite;
+        std::vector<WaveSample> _interleaved;
+
+        /**
+         * @brief Frames of the composite already rendered offline.
+         *
+         */
+        unsigned _composite_offset;
+
+        std::unique_ptr<ThreadPool> _pool;
+        std::vector<std::future<void>> _jobs;
+
+        /**
+         * @brief Converts sources to the output device sample rate.
+         *
+         */
+        const Resampler *_resampler;
+
+        /**
+         * @brief Mix sources at the engine sample rate and resample only the
+         * composite to the output device sample rate.
+         *
+         */
+        bool _composite_resampling;
+        StreamResampler _composite_stream;
+
+        /**
+         * @brief Composite resampling requested by the caller, applied by the
+         * mixing thread before it mixes.
+         *
+         */
+        std::atomic<bool> _composite_resampling_request{false};
+
+        /**
+         * @brief Decodes the ambisonic bus of the sources to binaural, if
+         * enabled.
+         *
+         */
+        std::unique_ptr<AmbisonicDecoder> _ambisonics;
+        Buffer _binaural;
+        Buffer _binaural_remixed;
+
+        /**
+         * @brief Decoder requested by the caller, swapped in by the mixing
+         * thread before it mixes.
+         *
+         * The replaced decoder is left here, so it is freed by the next
+         * request instead of on the mixing thread.
+         *
+         */
+        std::mutex _ambisonics_mutex;
+        std::unique_ptr<AmbisonicDecoder> _ambisonics_request;
+        bool _ambisonics_changed = false;
+        std::atomic<unsigned> _ambisonic_order{0};
 
         Listener _listener;
         std::vector<SourceRef> _sources;
@@ -56,10 +273,67 @@ namespace Dynamo::Sound {
             RingBuffer<WaveSample, BUFFER_SIZE> buffer;
             unsigned channels;
             double sample_rate;
+
+            // Buffer fill levels (in samples) that pace the mixer
+            unsigned high_water;
+            unsigned low_water;
+
+            std::mutex mutex;
+            std::condition_variable demand;
+
+            // Instrumentation updated by the callback and read by stats()
+            std::atomic<unsigned long long> callbacks{0};
+            std::atomic<unsigned long long> xruns{0};
+            std::atomic<unsigned long long> underflow_flags{0};
+            std::atomic<unsigned long long> overflow_flags{0};
+            std::array<std::atomic<unsigned long long>, FILL_HISTOGRAM_BINS> fill_histogram = {};
+
+            // Callback intervals in microseconds
+            std::atomic<unsigned long long> interval_count{0};
+            std::atomic<unsigned long long> interval_sum{0};
+            std::atomic<unsigned long long> interval_square_sum{0};
+            std::atomic<unsigned long long> interval_max{0};
+            std::chrono::steady_clock::time_point last_callback;
         };
         PaState _input_state;
         PaState _output_state;
 
+        /**
+         * @brief Number of mixed chunks that overflowed the output buffer.
+         *
+         */
+        std::atomic<unsigned long long> _output_overruns{0};
+
+        /**
+         * @brief Mixing time of updates, in nanoseconds.
+         *
+         * These are written by the mixing thread and polled by stats(). The
+         * sequence is odd while a record is in progress, so the count and
+         * sum are always read as a consistent pair.
+         *
+         */
+        std::atomic<unsigned long long> _mix_sequence{0};
+        std::atomic<unsigned long long> _mix_count{0};
+        std::atomic<unsigned long long> _mix_time{0};
+        std::atomic<unsigned long long> _mix_time_sum{0};
+        std::atomic<unsigned long long> _mix_time_max{0};
+
+        /**
+         * @brief Record the timing and status of a device callback.
+         *
+         * @param state
+         * @param underflow Did PortAudio flag an underflow on the stream?
+         * @param overflow  Did PortAudio flag an overflow on the stream?
+         */
+        static void record_callback(PaState &state, bool underflow, bool overflow);
+
+        /**
+         * @brief Record the time spent mixing by an update.
+         *
+         * @param start
+         */
+        void record_mix(std::chrono::steady_clock::time_point start);
+
         /**
          * @brief Callback for pulling data from the input device.
          *
@@ -97,18 +371,65 @@ namespace Dynamo::Sound {
                                    void *data);
 
         /**
-         * @brief Process a sound source.
+         * @brief Process a sound source and mix it onto the context composite.
          *
          * @param source
+         * @param context
+         */
+        void process_source(Source &source, MixContext &context);
+
+        /**
+         * @brief Process a group of sound sources.
+         *
+         * @param group Index of the group.
+         */
+        void process_group(unsigned group);
+
+        /**
+         * @brief Restart the composite resampler stream at the current output
+         * device sample rate.
+         *
+         */
+        void reset_composite_stream();
+
+        /**
+         * @brief Apply the settings requested since the last mix.
+         *
+         * This runs on the mixing thread, so the mixer state is never
+         * replaced while a chunk is being mixed.
+         *
          */
-        void process_source(Source &source);
+        void apply_settings();
+
+        /**
+         * @brief Mix a single chunk of all sources and write it into the
+         * output buffer.
+         *
+         */
+        void mix_chunk();
 
       public:
         /**
          * @brief Construct a new Jukebox object.
          *
+         * If mix_threads is non-zero, groups of sources are processed in
+         * parallel on a pool of worker threads. Filters must then not be
+         * shared between sources that are playing simultaneously.
+         *
+         * @param mix_threads Number of mixing worker threads.
          */
-        Jukebox();
+        Jukebox(unsigned mix_threads = 0);
+
+        /**
+         * @brief Construct a new offline Jukebox object.
+         *
+         * No sound devices are opened. Mixes are only computed by render(),
+         * as fast as the CPU allows.
+         *
+         * @param output      Output format.
+         * @param mix_threads Number of mixing worker threads.
+         */
+        Jukebox(const OfflineOutput &output, unsigned mix_threads = 0);
         ~Jukebox();
 
         /**
@@ -157,6 +478,53 @@ namespace Dynamo::Sound {
          */
         float get_volume() const;
 
+        /**
+         * @brief Set whether sources are mixed at STANDARD_SAMPLE_RATE and
+         * the composite is resampled to the output device sample rate in a
+         * single pass.
+         *
+         * This makes the resampling cost independent of the number of
+         * sources, but fractional seek positions are truncated to whole
+         * frames.
+         *
+         * @param enabled
+         */
+        void set_composite_resampling(bool enabled);
+
+        /**
+         * @brief Is the composite resampled instead of each source?
+         *
+         * @return true
+         * @return false
+         */
+        bool get_composite_resampling() const;
+
+        /**
+         * @brief Set the order of the ambisonic bus, or 0 to disable it.
+         *
+         * Ambisonic sources are encoded into a B-format bus, which is rotated
+         * by the listener and decoded to binaural once per chunk. The
+         * spatialization cost is then nearly independent of the number of
+         * sources, unlike the Binaural filter.
+         *
+         * @param order Ambisonic order, at most MAX_AMBISONIC_ORDER.
+         */
+        void set_ambisonic_order(unsigned order);
+
+        /**
+         * @brief Get the order of the ambisonic bus, or 0 if it is disabled.
+         *
+         * @return unsigned
+         */
+        unsigned get_ambisonic_order() const;
+
+        /**
+         * @brief Get a snapshot of the timing and buffer instrumentation.
+         *
+         * @return JukeboxStats
+         */
+        JukeboxStats stats() const;
+
         /**
          * @brief Is the output device playing?
          *
@@ -205,7 +573,34 @@ namespace Dynamo::Sound {
          * @brief Update Jukebox's internal state and process all sources
          * to be written into the output buffer.
          *
+         * This mixes chunks until the output buffer holds MIX_AHEAD_CHUNKS
+         * chunks, and returns immediately if it is already full.
+         *
          */
         void update();
+
+        /**
+         * @brief Mix the next frames of an offline Jukebox into a planar
+         * buffer.
+         *
+         * The mix continues from the end of the previous render. Chunks are
+         * read from the composite directly, so any number of output channels
+         * can be rendered.
+         *
+         * @param dst    Destination buffer, resized to the output channels.
+         * @param frames Number of frames at the output sample rate.
+         */
+        void render(Buffer &dst, unsigned frames);
+
+        /**
+         * @brief Block until the output device drains the buffer below
+         * MIX_WAKE_CHUNKS chunks and more samples must be mixed.
+         *
+         * This lets the audio thread sleep between updates instead of
+         * spinning.
+         *
+         * @param timeout Maximum time to wait.
+         */
+        void wait(Seconds timeout = Seconds(0.1));
     };
 } // namespace Dynamo::Sound
\ No newline at end of file
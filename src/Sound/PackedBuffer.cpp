@@ -0,0 +1,168 @@
+#include <Math/Vectorize.hpp>
+#include <Sound/PackedBuffer.hpp>
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+namespace Dynamo::Sound {
+    /**
+     * @brief Scale between floating point and 16-bit samples.
+     *
+     */
+    static constexpr float INT16_SCALE = 32767;
+
+    /**
+     * @brief IMA-ADPCM quantizer step sizes.
+     *
+     */
+    static constexpr std::array<int, 89> ADPCM_STEPS = {
+        7,     8,     9,     10,    11,    12,    13,    14,    16,    17,    19,    21,    23,    25,    28,
+        31,    34,    37,    41,    45,    50,    55,    60,    66,    73,    80,    88,    97,    107,   118,
+        130,   143,   157,   173,   190,   209,   230,   253,   279,   307,   337,   371,   408,   449,   494,
+        544,   598,   658,   724,   796,   876,   963,   1060,  1166,  1282,  1411,  1552,  1707,  1878,  2066,
+        2272,  2499,  2749,  3024,  3327,  3660,  4026,  4428,  4871,  5358,  5894,  6484,  7132,  7845,  8630,
+        9493,  10442, 11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767,
+    };
+
+    /**
+     * @brief IMA-ADPCM step index adjustment for each code magnitude.
+     *
+     */
+    static constexpr std::array<int, 8> ADPCM_INDEX_SHIFT = {-1, -1, -1, -1, 2, 4, 6, 8};
+
+    /**
+     * @brief IMA-ADPCM codec state.
+     *
+     */
+    struct AdpcmState {
+        int predictor;
+        int index;
+
+        /**
+         * @brief Update the state with a 4-bit code and get the next sample.
+         *
+         * @param code
+         * @return int
+         */
+        int update(unsigned code) {
+            int step = ADPCM_STEPS[index];
+            int delta = step >> 3;
+            if (code & 4) delta += step;
+            if (code & 2) delta += step >> 1;
+            if (code & 1) delta += step >> 2;
+
+            predictor = std::clamp(predictor + ((code & 8) ? -delta : delta), -32768, 32767);
+            index = std::clamp(index + ADPCM_INDEX_SHIFT[code & 7], 0, 88);
+            return predictor;
+        }
+
+        /**
+         * @brief Quantize the difference between a sample and the prediction.
+         *
+         * @param sample
+         * @return unsigned
+         */
+        unsigned encode(int sample) const {
+            int step = ADPCM_STEPS[index];
+            int diff = sample - predictor;
+            unsigned code = 0;
+            if (diff < 0) {
+                code = 8;
+                diff = -diff;
+            }
+            if (diff >= step) {
+                code |= 4;
+                diff -= step;
+            }
+            if (diff >= step >> 1) {
+                code |= 2;
+                diff -= step >> 1;
+            }
+            if (diff >= step >> 2) {
+                code |= 1;
+            }
+            return code;
+        }
+    };
+
+    PackedBuffer::PackedBuffer() : _format(SampleFormat::Int16), _frames(0), _channels(0), _stride(0) {}
+
+    PackedBuffer::PackedBuffer(const Buffer &buffer, SampleFormat format) :
+        _format(format), _frames(buffer.frames()), _channels(buffer.channels()) {
+        unsigned blocks = (_frames + ADPCM_BLOCK_FRAMES - 1) / ADPCM_BLOCK_FRAMES;
+        _stride = format == SampleFormat::ADPCM ? blocks * ADPCM_BLOCK_WORDS : _frames;
+
+        std::vector<std::int16_t> data(_stride * _channels);
+        for (unsigned c = 0; c < _channels; c++) {
+            const WaveSample *src = buffer[c];
+            std::int16_t *dst = data.data() + c * _stride;
+
+            // Quantize to 16-bit samples
+            std::vector<std::int16_t> samples(blocks * ADPCM_BLOCK_FRAMES, 0);
+            for (unsigned f = 0; f < _frames; f++) {
+                samples[f] = std::lrint(std::clamp(src[f], -1.0f, 1.0f) * INT16_SCALE);
+            }
+            if (format == SampleFormat::Int16) {
+                std::copy(samples.begin(), samples.begin() + _frames, dst);
+                continue;
+            }
+
+            // Encode each block, carrying the codec state across blocks
+            AdpcmState state = {_frames ? samples[0] : 0, 0};
+            for (unsigned b = 0; b < blocks; b++) {
+                std::int16_t *block = dst + b * ADPCM_BLOCK_WORDS;
+                block[0] = state.predictor;
+                block[1] = state.index;
+                for (unsigned i = 0; i < ADPCM_BLOCK_FRAMES; i++) {
+                    unsigned code = state.encode(samples[b * ADPCM_BLOCK_FRAMES + i]);
+                    state.update(code);
+                    block[2 + i / 4] |= code << ((i % 4) * 4);
+                }
+            }
+        }
+        _data = std::make_shared<const std::vector<std::int16_t>>(std::move(data));
+    }
+
+    void PackedBuffer::decode_block(const std::int16_t *block, std::int16_t *dst) {
+        AdpcmState state = {block[0], block[1]};
+        for (unsigned i = 0; i < ADPCM_BLOCK_FRAMES; i++) {
+            unsigned word = static_cast<std::uint16_t>(block[2 + i / 4]);
+            dst[i] = state.update((word >> ((i % 4) * 4)) & 15);
+        }
+    }
+
+    SampleFormat PackedBuffer::format() const { return _format; }
+
+    unsigned PackedBuffer::frames() const { return _frames; }
+
+    unsigned PackedBuffer::channels() const { return _channels; }
+
+    std::size_t PackedBuffer::size() const { return _data ? _data->size() * sizeof(std::int16_t) : 0; }
+
+    void PackedBuffer::decode(Buffer &dst, unsigned offset, unsigned length, unsigned dst_offset) const {
+        DYN_ASSERT(offset + length <= _frames);
+        DYN_ASSERT(dst.channels() >= _channels && dst_offset + length <= dst.frames());
+        if (length == 0) return;
+
+        for (unsigned c = 0; c < _channels; c++) {
+            const std::int16_t *src = _data->data() + c * _stride;
+            WaveSample *samples = dst[c] + dst_offset;
+            if (_format == SampleFormat::Int16) {
+                Vectorize::i16tof(src + offset, 1 / INT16_SCALE, samples, length);
+                continue;
+            }
+
+            // Decode each overlapping block and convert the covered frames
+            std::array<std::int16_t, ADPCM_BLOCK_FRAMES> block;
+            unsigned frame = offset;
+            while (frame < offset + length) {
+                unsigned b = frame / ADPCM_BLOCK_FRAMES;
+                unsigned start = frame - b * ADPCM_BLOCK_FRAMES;
+                unsigned count = std::min(ADPCM_BLOCK_FRAMES - start, offset + length - frame);
+                decode_block(src + b * ADPCM_BLOCK_WORDS, block.data());
+                Vectorize::i16tof(block.data() + start, 1 / INT16_SCALE, samples + (frame - offset), count);
+                frame += count;
+            }
+        }
+    }
+} // namespace Dynamo::Sound
\ No newline at end of file
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <Sound/Buffer.hpp>
+
+namespace Dynamo::Sound {
+    /**
+     * @brief Number of frames in an IMA-ADPCM block.
+     *
+     * Each block can be decoded independently, so this bounds the work
+     * wasted when decoding from an arbitrary frame.
+     *
+     */
+    static constexpr unsigned ADPCM_BLOCK_FRAMES = 64;
+
+    /**
+     * @brief Number of 16-bit words in an IMA-ADPCM block, holding the
+     * initial predictor and step index followed by 4-bit codes.
+     *
+     */
+    static constexpr unsigned ADPCM_BLOCK_WORDS = 2 + ADPCM_BLOCK_FRAMES / 4;
+
+    /**
+     * @brief Compact sample encodings.
+     *
+     */
+    enum class SampleFormat {
+        /**
+         * @brief 16-bit PCM, half the size of floating point samples.
+         *
+         */
+        Int16,
+
+        /**
+         * @brief 4-bit IMA-ADPCM, about a seventh of the size of floating
+         * point samples.
+         *
+         */
+        ADPCM,
+    };
+
+    /**
+     * @brief Immutable multi-channel clip stored in a compact sample format.
+     *
+     * Frames are decoded to floating point on demand, so a clip can stay
+     * resident at a fraction of the memory of a Buffer. Copies share the
+     * encoded samples.
+     *
+     */
+    class PackedBuffer {
+        std::shared_ptr<const std::vector<std::int16_t>> _data;
+        SampleFormat _format;
+
+        unsigned _frames;
+        unsigned _channels;
+
+        /**
+         * @brief Number of 16-bit words per channel.
+         *
+         */
+        unsigned _stride;
+
+        /**
+         * @brief Decode an IMA-ADPCM block.
+         *
+         * @param block Encoded block.
+         * @param dst   Destination of ADPCM_BLOCK_FRAMES samples.
+         */
+        static void decode_block(const std::int16_t *block, std::int16_t *dst);
+
+      public:
+        /**
+         * @brief Construct an empty PackedBuffer.
+         *
+         */
+        PackedBuffer();
+
+        /**
+         * @brief Encode the samples of a Buffer.
+         *
+         * Samples are clamped to [-1.0, +1.0].
+         *
+         * @param buffer Source buffer.
+         * @param format Sample encoding.
+         */
+        PackedBuffer(const Buffer &buffer, SampleFormat format);
+
+        /**
+         * @brief Get the sample encoding.
+         *
+         * @return SampleFormat
+         */
+        SampleFormat format() const;
+
+        /**
+         * @brief Get the number of frames.
+         *
+         * @return unsigned
+         */
+        unsigned frames() const;
+
+        /**
+         * @brief Get the number of channels.
+         *
+         * @return unsigned
+         */
+        unsigned channels() const;
+
+        /**
+         * @brief Get the number of bytes used by the encoded samples.
+         *
+         * @return std::size_t
+         */
+        std::size_t size() const;
+
+        /**
+         * @brief Decode a range of frames of each channel.
+         *
+         * @param dst        Destination buffer with at least as many channels.
+         * @param offset     First frame to decode.
+         * @param length     Number of frames.
+         * @param dst_offset Frame offset in the destination buffer.
+         */
+        void decode(Buffer &dst, unsigned offset, unsigned length, unsigned dst_offset = 0) const;
+    };
+} // namespace Dynamo::Sound
\ No newline at end of file
@@ -3,31 +3,67 @@
 #include <algorithm>
 
 namespace Dynamo::Sound {
-    Source::Source(Buffer &buffer, std::optional<FilterRef> filter) :
-        _buffer(buffer), _filter(filter), _frame(0), _frame_start(0), _frame_stop(_buffer.get().frames()),
-        _playing(false), _on_finish([]() {}) {}
+    Source::Source(const Buffer &buffer, std::optional<FilterRef> filter) :
+        _buffer(buffer), _streaming(nullptr), _filter(filter), _ambisonic(false), _frame(0), _frame_start(0),
+        _frame_stop(buffer.frames()), _playing(false), _on_finish([]() {}) {}
+
+    Source::Source(const PackedBuffer &buffer, std::optional<FilterRef> filter) :
+        _packed(buffer), _streaming(nullptr), _filter(filter), _ambisonic(false), _frame(0), _frame_start(0),
+        _frame_stop(buffer.frames()), _playing(false), _on_finish([]() {}) {}
+
+    Source::Source(Stream &stream, std::optional<FilterRef> filter) :
+        _streaming(&stream), _filter(filter), _ambisonic(false), _frame(0), _frame_start(0),
+        _frame_stop(stream.frames()), _playing(false), _on_finish([]() {}) {}
+
+    unsigned Source::frames() const {
+        if (_streaming) return _streaming->frames();
+        return _packed ? _packed->frames() : _buffer.frames();
+    }
+
+    unsigned Source::channels() const {
+        if (_streaming) return _streaming->channels();
+        return _packed ? _packed->channels() : _buffer.channels();
+    }
+
+    bool Source::resident() const { return !_streaming && !_packed; }
+
+    void Source::read(Buffer &dst, unsigned offset, unsigned length) {
+        if (_streaming) {
+            _streaming->read(dst, offset, length);
+        } else if (_packed) {
+            _packed->decode(dst, offset, length);
+        } else {
+            // Read through a const reference so the shared samples are not
+            // copied
+            const Buffer &buffer = _buffer;
+            for (unsigned c = 0; c < buffer.channels(); c++) {
+                std::copy(buffer[c] + offset, buffer[c] + offset + length, dst[c]);
+            }
+        }
+    }
 
     bool Source::is_playing() const { return _playing; }
 
     void Source::seek(Seconds time) {
-        _frame = std::clamp(_frame_start + STANDARD_SAMPLE_RATE * time.count(),
-                            0.0,
-                            static_cast<double>(_buffer.get().frames()));
+        _frame = std::clamp(_frame_start + STANDARD_SAMPLE_RATE * time.count(), 0.0, static_cast<double>(frames()));
     }
 
     void Source::set_start(Seconds time) {
-        _frame_start =
-            std::clamp(STANDARD_SAMPLE_RATE * time.count(), 0.0, static_cast<double>(_buffer.get().frames()));
+        _frame_start = std::clamp(STANDARD_SAMPLE_RATE * time.count(), 0.0, static_cast<double>(frames()));
     }
 
     void Source::set_stop(Seconds time) {
-        _frame_stop = std::clamp(STANDARD_SAMPLE_RATE * time.count(), 0.0, static_cast<double>(_buffer.get().frames()));
+        _frame_stop = std::clamp(STANDARD_SAMPLE_RATE * time.count(), 0.0, static_cast<double>(frames()));
     }
 
     void Source::set_duration(Seconds time) {
         float count = STANDARD_SAMPLE_RATE * time.count();
-        _frame_stop = std::clamp(_frame_start + count, 0.0, static_cast<double>(_buffer.get().frames()));
+        _frame_stop = std::clamp(_frame_start + count, 0.0, static_cast<double>(frames()));
     }
 
     void Source::set_on_finish(std::function<void()> handler) { _on_finish = handler; }
+
+    void Source::set_ambisonic(bool enabled) { _ambisonic = enabled; }
+
+    bool Source::is_ambisonic() const { return _ambisonic; }
 } // namespace Dynamo::Sound
\ No newline at end of file
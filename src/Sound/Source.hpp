@@ -6,7 +6,10 @@
 
 #include <Math/Vec3.hpp>
 #include <Sound/Buffer.hpp>
+#include <Sound/DSP/Resample.hpp>
 #include <Sound/Filter.hpp>
+#include <Sound/PackedBuffer.hpp>
+#include <Sound/Stream.hpp>
 
 namespace Dynamo::Sound {
     /**
@@ -14,17 +17,54 @@ namespace Dynamo::Sound {
      *
      */
     class Source {
-        BufferRef _buffer;
+        Buffer _buffer;
+        std::optional<PackedBuffer> _packed;
+        Stream *_streaming;
         std::optional<FilterRef> _filter;
+        bool _ambisonic;
 
         double _frame;
         double _frame_start;
         double _frame_stop;
 
+        StreamResampler _stream;
+
         mutable std::atomic_bool _playing;
 
         std::function<void()> _on_finish;
 
+        /**
+         * @brief Get the number of frames in the clip.
+         *
+         * @return unsigned
+         */
+        unsigned frames() const;
+
+        /**
+         * @brief Get the number of channels in the clip.
+         *
+         * @return unsigned
+         */
+        unsigned channels() const;
+
+        /**
+         * @brief Is the clip stored as floating point samples that can be
+         * read in-place?
+         *
+         * @return true
+         * @return false
+         */
+        bool resident() const;
+
+        /**
+         * @brief Read a range of frames of the clip.
+         *
+         * @param dst    Destination buffer with at least as many channels.
+         * @param offset First frame to read.
+         * @param length Number of frames.
+         */
+        void read(Buffer &dst, unsigned offset, unsigned length);
+
         friend class Jukebox;
 
       public:
@@ -43,10 +83,35 @@ namespace Dynamo::Sound {
         /**
          * @brief Construct a new sound source.
          *
+         * The source shares the sample store of the buffer without copying
+         * it. Later edits to the buffer are not heard by the source.
+         *
+         * @param buffer
+         * @param filter
+         */
+        Source(const Buffer &buffer, std::optional<FilterRef> filter = {});
+
+        /**
+         * @brief Construct a new sound source from a compact clip, which is
+         * decoded chunk by chunk during playback.
+         *
+         * The source shares the encoded samples without copying them.
+         *
          * @param buffer
          * @param filter
          */
-        Source(Buffer &buffer, std::optional<FilterRef> filter = {});
+        Source(const PackedBuffer &buffer, std::optional<FilterRef> filter = {});
+
+        /**
+         * @brief Construct a new sound source from a stream, which is decoded
+         * ahead of playback on a background thread.
+         *
+         * The stream must outlive the source.
+         *
+         * @param stream
+         * @param filter
+         */
+        Source(Stream &stream, std::optional<FilterRef> filter = {});
 
         /**
          * @brief Check if the source is playing.
@@ -91,6 +156,26 @@ namespace Dynamo::Sound {
          * @param handler
          */
         void set_on_finish(std::function<void()> handler);
+
+        /**
+         * @brief Set whether the source is spatialized through the ambisonic
+         * bus of the Jukebox instead of being mixed onto its channels.
+         *
+         * The filter is applied before the source is encoded, e.g., to
+         * attenuate it with distance. This has no effect if the Jukebox has
+         * no ambisonic bus.
+         *
+         * @param enabled
+         */
+        void set_ambisonic(bool enabled);
+
+        /**
+         * @brief Is the source spatialized through the ambisonic bus?
+         *
+         * @return true
+         * @return false
+         */
+        bool is_ambisonic() const;
     };
 
     using SourceRef = std::reference_wrapper<Source>;
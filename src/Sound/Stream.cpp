@@ -0,0 +1,144 @@
+#include <Sound/Stream.hpp>
+#include <algorithm>
+
+namespace Dynamo::Sound {
+    Stream::Stream(std::unique_ptr<StreamDecoder> decoder) :
+        _decoder(std::move(decoder)), _position(0), _generation(0), _restart(true), _running(true) {
+        _channels = _decoder->channels();
+        _frames = _decoder->frames() * (STANDARD_SAMPLE_RATE / _decoder->sample_rate());
+
+        _resampler = nullptr;
+        if (_decoder->sample_rate() != STANDARD_SAMPLE_RATE) {
+            _resampler = &Resampler::get(_decoder->sample_rate(), STANDARD_SAMPLE_RATE);
+        }
+
+        for (unsigned c = 0; c < _channels; c++) {
+            _rings.emplace_back(std::make_unique<RingBuffer<WaveSample, STREAM_BUFFER_FRAMES>>());
+        }
+        _thread = std::thread([this]() { thread_main(); });
+    }
+
+    Stream::~Stream() {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _running = false;
+        }
+        _demand.notify_one();
+        _thread.join();
+    }
+
+    void Stream::restart(unsigned frame) {
+        if (_resampler == nullptr) {
+            _decoder->seek(frame);
+            return;
+        }
+
+        // Start the resampler at the matching decoder frame, silent before
+        // the start of the sound
+        _resampler_stream.reset(*_resampler, _channels, frame * (_decoder->sample_rate() / STANDARD_SAMPLE_RATE));
+        long long next = _resampler_stream.next_frame();
+        if (next < 0) {
+            _resampler_stream.write_silence(-next);
+            next = 0;
+        }
+        _decoder->seek(next);
+    }
+
+    void Stream::decode(unsigned length) {
+        _output.resize(length, _channels);
+        Buffer &input = _resampler ? _input : _output;
+        if (_resampler) {
+            _input.resize(_resampler_stream.required(length), _channels);
+        }
+
+        // Read the decoded frames, silent past the end of the sound
+        unsigned read = _decoder->read(input);
+        for (unsigned c = 0; c < _channels; c++) {
+            std::fill(input[c] + read, input[c] + input.frames(), 0);
+        }
+
+        if (_resampler) {
+            _resampler_stream.write(_input, 0, _input.frames());
+            _resampler_stream.read(_output, length);
+        }
+    }
+
+    void Stream::thread_main() {
+        std::unique_lock<std::mutex> lock(_mutex);
+        while (true) {
+            // Wait until there is room for another chunk or a seek
+            _demand.wait(lock, [this]() {
+                return !_running || _restart ||
+                       (_position < _frames && _rings[0]->remaining() >= STREAM_CHUNK_FRAMES);
+            });
+            if (!_running) break;
+
+            bool restart = _restart;
+            unsigned generation = _generation;
+            unsigned position = _position;
+            unsigned length = std::min(STREAM_CHUNK_FRAMES, _frames - std::min(position, _frames));
+            _restart = false;
+
+            // Decode out of the lock context
+            lock.unlock();
+            if (restart) {
+                this->restart(position);
+            }
+            if (length > 0) {
+                decode(length);
+            }
+            lock.lock();
+
+            // Discard the chunk if the stream was seeked in the meantime
+            if (generation == _generation && length > 0) {
+                for (unsigned c = 0; c < _channels; c++) {
+                    _rings[c]->write(_output[c], length);
+                }
+                _position += length;
+            }
+        }
+    }
+
+    unsigned Stream::channels() const { return _channels; }
+
+    unsigned Stream::frames() const { return _frames; }
+
+    unsigned Stream::buffered() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _channels ? _rings[0]->size() : 0;
+    }
+
+    void Stream::read(Buffer &dst, unsigned offset, unsigned length) {
+        DYN_ASSERT(dst.channels() >= _channels && length <= dst.frames());
+        unsigned available = 0;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            unsigned size = _channels ? _rings[0]->size() : 0;
+            unsigned front = _position - size;
+            if (offset < front || offset > _position + STREAM_BUFFER_FRAMES) {
+                // Restart decoding from the new position
+                for (unsigned c = 0; c < _channels; c++) {
+                    _rings[c]->clear();
+                }
+                _position = offset;
+                _generation++;
+                _restart = true;
+            } else {
+                // Skip frames that were not read in time, letting the
+                // read-ahead thread catch up after an underrun
+                unsigned skip = std::min(offset - front, size);
+                available = std::min(length, size - skip);
+                for (unsigned c = 0; c < _channels; c++) {
+                    _rings[c]->skip(skip);
+                    _rings[c]->read(dst[c], available);
+                }
+            }
+        }
+        _demand.notify_one();
+
+        // Frames that are not ready yet are silent
+        for (unsigned c = 0; c < _channels; c++) {
+            std::fill(dst[c] + available, dst[c] + length, 0);
+        }
+    }
+} // namespace Dynamo::Sound
\ No newline at end of file
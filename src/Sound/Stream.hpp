@@ -0,0 +1,193 @@
+#pragma once
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <Utils/RingBuffer.hpp>
+
+#include <Sound/Buffer.hpp>
+#include <Sound/DSP/Resample.hpp>
+
+namespace Dynamo::Sound {
+    /**
+     * @brief Number of frames per channel a stream decodes ahead of playback.
+     *
+     * This bounds the memory of a stream regardless of the length of the
+     * sound.
+     *
+     */
+    static constexpr unsigned STREAM_BUFFER_FRAMES = 1 << 13;
+
+    /**
+     * @brief Number of frames decoded and resampled at a time by the
+     * read-ahead thread.
+     *
+     */
+    static constexpr unsigned STREAM_CHUNK_FRAMES = 1 << 10;
+
+    /**
+     * @brief Sequential reader of an encoded sound, e.g., a file.
+     *
+     */
+    class StreamDecoder {
+      public:
+        virtual ~StreamDecoder() = default;
+
+        /**
+         * @brief Get the number of channels.
+         *
+         * @return unsigned
+         */
+        virtual unsigned channels() const = 0;
+
+        /**
+         * @brief Get the sample rate of the encoded sound.
+         *
+         * @return double
+         */
+        virtual double sample_rate() const = 0;
+
+        /**
+         * @brief Get the number of frames at the encoded sample rate.
+         *
+         * @return unsigned
+         */
+        virtual unsigned frames() const = 0;
+
+        /**
+         * @brief Move the read position to a frame.
+         *
+         * @param frame
+         */
+        virtual void seek(unsigned frame) = 0;
+
+        /**
+         * @brief Read up to dst.frames() frames into a planar buffer,
+         * advancing the read position.
+         *
+         * @param dst Destination buffer with as many channels.
+         * @return unsigned Number of frames read.
+         */
+        virtual unsigned read(Buffer &dst) = 0;
+    };
+
+    /**
+     * @brief Sound that is decoded and resampled to STANDARD_SAMPLE_RATE on
+     * a background thread as it is played, instead of being loaded whole.
+     *
+     * Frames are read ahead into a bounded ring. A stream can be played by
+     * one source at a time.
+     *
+     */
+    class Stream {
+        std::unique_ptr<StreamDecoder> _decoder;
+        unsigned _channels;
+        unsigned _frames;
+
+        /**
+         * @brief Converts the decoded frames to the engine sample rate, unused
+         * if the rates match.
+         *
+         */
+        const Resampler *_resampler;
+        StreamResampler _resampler_stream;
+
+        /**
+         * @brief Working buffers of the read-ahead thread.
+         *
+         */
+        Buffer _input;
+        Buffer _output;
+
+        /**
+         * @brief Read-ahead frames of each channel.
+         *
+         */
+        std::vector<std::unique_ptr<RingBuffer<WaveSample, STREAM_BUFFER_FRAMES>>> _rings;
+
+        /**
+         * @brief Engine frame after the back of the rings.
+         *
+         */
+        unsigned _position;
+
+        /**
+         * @brief Incremented on every seek, so the read-ahead thread can
+         * discard a chunk decoded from the previous position.
+         *
+         */
+        unsigned _generation;
+        bool _restart;
+        bool _running;
+
+        std::mutex _mutex;
+        std::condition_variable _demand;
+        std::thread _thread;
+
+        /**
+         * @brief Move the decoder to an engine frame.
+         *
+         * @param frame
+         */
+        void restart(unsigned frame);
+
+        /**
+         * @brief Decode and resample the next frames into the output buffer.
+         *
+         * @param length Number of engine frames.
+         */
+        void decode(unsigned length);
+
+        /**
+         * @brief Read-ahead thread loop.
+         *
+         */
+        void thread_main();
+
+      public:
+        /**
+         * @brief Construct a new Stream and start reading ahead.
+         *
+         * @param decoder
+         */
+        Stream(std::unique_ptr<StreamDecoder> decoder);
+        ~Stream();
+
+        /**
+         * @brief Get the number of channels.
+         *
+         * @return unsigned
+         */
+        unsigned channels() const;
+
+        /**
+         * @brief Get the number of frames at the engine sample rate.
+         *
+         * @return unsigned
+         */
+        unsigned frames() const;
+
+        /**
+         * @brief Get the number of frames read ahead.
+         *
+         * @return unsigned
+         */
+        unsigned buffered();
+
+        /**
+         * @brief Read a range of engine frames of each channel.
+         *
+         * Frames that have not been decoded yet are silent and skipped once
+         * they are. Reading before the buffered frames or far past them seeks
+         * the stream.
+         *
+         * @param dst    Destination buffer with at least as many channels.
+         * @param offset First frame to read.
+         * @param length Number of frames.
+         */
+        void read(Buffer &dst, unsigned offset, unsigned length);
+    };
+} // namespace Dynamo::Sound
\ No newline at end of file
@@ -134,6 +134,21 @@ namespace Dynamo {
             return length;
         }
 
+        /**
+         * @brief Discard up to n values from the buffer, advancing the read
+         * pointer
+         *
+         * This will return the number of elements discarded
+         *
+         * @param n
+         * @return unsigned
+         */
+        inline unsigned skip(const unsigned n) {
+            unsigned length = std::min(n, size());
+            _read += length;
+            return length;
+        }
+
         /**
          * @brief Pop a value from the buffer, shifting back the write pointer
          *
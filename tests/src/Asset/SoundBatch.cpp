@@ -0,0 +1,76 @@
+#include <Dynamo.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <filesystem>
+
+static constexpr unsigned SOUND_COUNT = 16;
+
+/**
+ * @brief Save deterministic sound files to a temporary directory.
+ *
+ * @param directory
+ * @return std::vector<std::string> Paths of the saved files.
+ */
+std::vector<std::string> save_sounds(const std::filesystem::path &directory) {
+    std::filesystem::create_directories(directory);
+    std::vector<std::string> filepaths;
+    for (unsigned s = 0; s < SOUND_COUNT; s++) {
+        Dynamo::Sound::Buffer buffer(1000 + 500 * s, 2);
+        for (unsigned c = 0; c < buffer.channels(); c++) {
+            for (unsigned i = 0; i < buffer.frames(); i++) {
+                buffer[c][i] = 0.1 * std::sin(0.01 * (s + 1) * i + c);
+            }
+        }
+        filepaths.emplace_back((directory / ("sound_" + std::to_string(s) + ".wav")).string());
+        Dynamo::save_sound(filepaths.back(), buffer, Dynamo::Sound::STANDARD_SAMPLE_RATE);
+    }
+    return filepaths;
+}
+
+TEST_CASE("SoundBatch load", "[SoundBatch]") {
+    std::filesystem::path directory = std::filesystem::temp_directory_path() / "dynamo_sound_batch";
+    std::vector<std::string> filepaths = save_sounds(directory);
+    Dynamo::ThreadPool pool(4);
+    Dynamo::SoundBatch batch = Dynamo::load_sounds(filepaths, pool);
+    REQUIRE(batch.size() == SOUND_COUNT);
+
+    batch.wait();
+    REQUIRE(batch.loaded() == SOUND_COUNT);
+    REQUIRE(batch.progress() == 1);
+    for (unsigned s = 0; s < SOUND_COUNT; s++) {
+        REQUIRE(batch.get(s).frames() == 1000 + 500 * s);
+        REQUIRE(batch.get(s).channels() == 2);
+    }
+
+    // Sounds that fail to load are counted and rethrow on get
+    Dynamo::SoundBatch missing = Dynamo::load_sounds({(directory / "missing.wav").string()}, pool);
+    missing.wait();
+    REQUIRE(missing.progress() == 1);
+    REQUIRE(missing.ready(0));
+    REQUIRE_THROWS(missing.get(0));
+    std::filesystem::remove_all(directory);
+}
+
+TEST_CASE("SoundBatch progress", "[SoundBatch]") {
+    std::filesystem::path directory = std::filesystem::temp_directory_path() / "dynamo_sound_batch_progress";
+    std::vector<std::string> filepaths = save_sounds(directory);
+    for (unsigned trial = 0; trial < 20; trial++) {
+        Dynamo::ThreadPool pool(4);
+        Dynamo::SoundBatch batch = Dynamo::load_sounds(filepaths, pool);
+
+        // Every sound counted by the progress can be retrieved
+        unsigned loaded = 0;
+        while (loaded < batch.size()) {
+            loaded = batch.loaded();
+            unsigned ready = 0;
+            for (unsigned s = 0; s < batch.size(); s++) {
+                ready += batch.ready(s);
+            }
+            REQUIRE(ready >= loaded);
+        }
+        REQUIRE(batch.progress() == 1);
+        for (unsigned s = 0; s < batch.size(); s++) {
+            REQUIRE(batch.ready(s));
+        }
+    }
+    std::filesystem::remove_all(directory);
+}
\ No newline at end of file
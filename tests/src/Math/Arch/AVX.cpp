@@ -5,6 +5,7 @@
 #if defined(DYNAMO_ARCH_AVX)
 #include <Math/Arch/AVX.hpp>
 
+#include "../../Common.hpp"
 #include "Common.hpp"
 
 TEST_CASE("Vectorize AVX smul", "[Vectorize]") {
@@ -73,6 +74,85 @@ TEST_CASE("Vectorize AVX vsma", "[Vectorize]") {
     }
 }
 
+TEST_CASE("Vectorize AVX vcma", "[Vectorize]") {
+    FloatArray src_a_re;
+    FloatArray src_a_im;
+    FloatArray src_b_re;
+    FloatArray src_b_im;
+    FloatArray dst_re;
+    FloatArray dst_im;
+    for (unsigned i = 0; i < LENGTH; i++) {
+        src_a_re[i] = (i % 17) * 0.25;
+        src_a_im[i] = (i % 13) * -0.5;
+        src_b_re[i] = (i % 11) * 0.125;
+        src_b_im[i] = (i % 7) * 0.75;
+    }
+    dst_re.fill(0);
+    dst_im.fill(0);
+
+    BENCHMARK("Vectorize AVX vcma benchmark") {
+        Dynamo::Vectorize::AVX::vcma(src_a_re.data(),
+                                     src_a_im.data(),
+                                     src_b_re.data(),
+                                     src_b_im.data(),
+                                     dst_re.data(),
+                                     dst_im.data(),
+                                     LENGTH);
+    };
+
+    dst_re.fill(1);
+    dst_im.fill(2);
+    Dynamo::Vectorize::AVX::vcma(src_a_re.data(),
+                                 src_a_im.data(),
+                                 src_b_re.data(),
+                                 src_b_im.data(),
+                                 dst_re.data(),
+                                 dst_im.data(),
+                                 LENGTH);
+    for (unsigned i = 0; i < LENGTH; i++) {
+        REQUIRE(dst_re[i] == 1 + src_a_re[i] * src_b_re[i] - src_a_im[i] * src_b_im[i]);
+        REQUIRE(dst_im[i] == 2 + src_a_re[i] * src_b_im[i] + src_a_im[i] * src_b_re[i]);
+    }
+}
+
+TEST_CASE("Vectorize AVX i16tof", "[Vectorize]") {
+    std::vector<std::int16_t> src(LENGTH);
+    FloatArray dst;
+    float scalar = 1.0f / 32768;
+    for (unsigned i = 0; i < LENGTH; i++) {
+        src[i] = static_cast<std::int16_t>(i * 97);
+    }
+
+    BENCHMARK("Vectorize AVX i16tof benchmark") {
+        Dynamo::Vectorize::AVX::i16tof(src.data(), scalar, dst.data(), LENGTH);
+    };
+
+    for (unsigned i = 0; i < LENGTH; i++) {
+        REQUIRE(dst[i] == src[i] * scalar);
+    }
+}
+
+TEST_CASE("Vectorize AVX vdot", "[Vectorize]") {
+    FloatArray src_a;
+    FloatArray src_b;
+    for (unsigned i = 0; i < LENGTH; i++) {
+        src_a[i] = (i % 17) * 0.25 - 2;
+        src_b[i] = (i % 11) * 0.125 - 0.5;
+    }
+
+    BENCHMARK("Vectorize AVX vdot benchmark") {
+        return Dynamo::Vectorize::AVX::vdot(src_a.data(), src_b.data(), LENGTH);
+    };
+
+    for (unsigned length = 0; length < 67; length++) {
+        double expected = 0;
+        for (unsigned i = 0; i < length; i++) {
+            expected += src_a[i] * src_b[i];
+        }
+        REQUIRE_THAT(Dynamo::Vectorize::AVX::vdot(src_a.data(), src_b.data(), length), Approx(expected, 1e-4));
+    }
+}
+
 TEST_CASE("Vectorize AVX vclamp", "[Vectorize]") {
     FloatArray src;
     FloatArray dst;
@@ -90,6 +170,102 @@ TEST_CASE("Vectorize AVX vclamp", "[Vectorize]") {
     }
 }
 
+TEST_CASE("Vectorize AVX interleave", "[Vectorize]") {
+    FloatArray src;
+    FloatArray dst;
+    fill_array(src);
+
+    for (unsigned channels : {1, 2, 4, 6, 8}) {
+        unsigned frames = LENGTH / channels;
+        BENCHMARK("Vectorize AVX interleave " + std::to_string(channels) + " benchmark") {
+            Dynamo::Vectorize::AVX::interleave(src.data(), dst.data(), channels, frames, frames);
+        };
+
+        for (unsigned f = 0; f < frames; f++) {
+            for (unsigned c = 0; c < channels; c++) {
+                REQUIRE(dst[f * channels + c] == src[c * frames + f]);
+            }
+        }
+    }
+}
+
+TEST_CASE("Vectorize AVX deinterleave", "[Vectorize]") {
+    FloatArray src;
+    FloatArray dst;
+    fill_array(src);
+
+    for (unsigned channels : {1, 2, 4, 6, 8}) {
+        unsigned frames = LENGTH / channels;
+        BENCHMARK("Vectorize AVX deinterleave " + std::to_string(channels) + " benchmark") {
+            Dynamo::Vectorize::AVX::deinterleave(src.data(), dst.data(), channels, frames, frames);
+        };
+
+        for (unsigned f = 0; f < frames; f++) {
+            for (unsigned c = 0; c < channels; c++) {
+                REQUIRE(dst[c * frames + f] == src[f * channels + c]);
+            }
+        }
+    }
+}
+
+TEST_CASE("Vectorize AVX radix4", "[Vectorize]") {
+    for (bool inverse : {false, true}) {
+        std::vector<float> twiddles = radix4_twiddles(RADIX4_STRIDE, inverse);
+        std::vector<float> src(RADIX4_STRIDE * 8);
+        for (unsigned i = 0; i < src.size(); i++) {
+            src[i] = std::sin(0.1 * i) + (i % 5) * 0.25;
+        }
+        std::vector<float> dst = src;
+
+        BENCHMARK(std::string("Vectorize AVX radix4 ") + (inverse ? "inverse " : "") + "benchmark") {
+            std::copy(src.begin(), src.end(), dst.begin());
+            Dynamo::Vectorize::AVX::radix4(dst.data(), twiddles.data(), RADIX4_STRIDE, RADIX4_STRIDE, inverse);
+        };
+
+        std::vector<float> expected = src;
+        radix4_reference(expected, twiddles, RADIX4_STRIDE, inverse);
+        dst = src;
+        Dynamo::Vectorize::AVX::radix4(dst.data(), twiddles.data(), RADIX4_STRIDE, RADIX4_STRIDE, inverse);
+        for (unsigned i = 0; i < dst.size(); i++) {
+            REQUIRE_THAT(dst[i], Approx(expected[i], 1e-4));
+        }
+    }
+}
+
+TEST_CASE("Vectorize AVX radix4 lanes", "[Vectorize]") {
+    unsigned j = 37;
+    for (bool inverse : {false, true}) {
+        std::vector<float> twiddles = radix4_twiddles(RADIX4_STRIDE, inverse);
+        std::vector<float> src(RADIX4_STRIDE * 8);
+        for (unsigned i = 0; i < src.size(); i++) {
+            src[i] = std::sin(0.1 * i) + (i % 5) * 0.25;
+        }
+        std::vector<float> dst = src;
+
+        BENCHMARK(std::string("Vectorize AVX radix4 lanes ") + (inverse ? "inverse " : "") + "benchmark") {
+            std::copy(src.begin(), src.end(), dst.begin());
+            Dynamo::Vectorize::AVX::radix4_lanes(dst.data(),
+                                                 twiddles.data() + j * 2,
+                                                 RADIX4_STRIDE,
+                                                 RADIX4_STRIDE,
+                                                 RADIX4_STRIDE,
+                                                 inverse);
+        };
+
+        std::vector<float> expected = src;
+        radix4_reference(expected, radix4_broadcast(twiddles, RADIX4_STRIDE, j), RADIX4_STRIDE, inverse);
+        dst = src;
+        Dynamo::Vectorize::AVX::radix4_lanes(dst.data(),
+                                             twiddles.data() + j * 2,
+                                             RADIX4_STRIDE,
+                                             RADIX4_STRIDE,
+                                             RADIX4_STRIDE,
+                                             inverse);
+        for (unsigned i = 0; i < dst.size(); i++) {
+            REQUIRE_THAT(dst[i], Approx(expected[i], 1e-4));
+        }
+    }
+}
 #else
 TEST_CASE("Vectorize AVX null", "[Vectorize]") { Dynamo::Log::info("AVX instruction set not supported."); }
 #endif
\ No newline at end of file
@@ -1,6 +1,9 @@
 #pragma once
 
 #include <array>
+#include <cmath>
+#include <complex>
+#include <vector>
 
 constexpr unsigned LENGTH = 123435;
 using FloatArray = std::array<float, LENGTH>;
@@ -10,3 +13,77 @@ inline void fill_array(FloatArray &arr) {
         arr[i] = i;
     }
 }
+
+constexpr unsigned RADIX4_STRIDE = 1024;
+
+/**
+ * @brief Generate the twiddle factors of a radix-4 stage.
+ *
+ * @param stride
+ * @param inverse
+ * @return std::vector<float>
+ */
+inline std::vector<float> radix4_twiddles(unsigned stride, bool inverse) {
+    std::vector<float> twiddles;
+    double sign = inverse ? 1 : -1;
+    for (unsigned t : {2, 1, 3}) {
+        for (unsigned j = 0; j < stride; j++) {
+            double angle = sign * 2 * M_PI * t * j / (4.0 * stride);
+            twiddles.push_back(std::cos(angle));
+            twiddles.push_back(std::sin(angle));
+        }
+    }
+    return twiddles;
+}
+
+/**
+ * @brief Reference radix-4 butterflies as a 4-point DFT of the twiddled
+ * inputs in bit-reversed order.
+ *
+ * @param signal
+ * @param twiddles
+ * @param stride
+ * @param inverse
+ */
+inline void radix4_reference(std::vector<float> &signal,
+                             const std::vector<float> &twiddles,
+                             unsigned stride,
+                             bool inverse) {
+    std::complex<double> w4(0, inverse ? 1 : -1);
+    for (unsigned j = 0; j < stride; j++) {
+        std::array<std::complex<double>, 4> x;
+        for (unsigned t = 0; t < 4; t++) {
+            x[t] = std::complex<double>(signal[(t * stride + j) * 2], signal[(t * stride + j) * 2 + 1]);
+            if (t > 0) {
+                unsigned w = ((t - 1) * stride + j) * 2;
+                x[t] *= std::complex<double>(twiddles[w], twiddles[w + 1]);
+            }
+        }
+        for (unsigned m = 0; m < 4; m++) {
+            std::complex<double> y = x[0] + std::pow(w4, 2 * m) * x[1] + std::pow(w4, m) * x[2] +
+                                     std::pow(w4, 3 * m) * x[3];
+            signal[(m * stride + j) * 2] = y.real();
+            signal[(m * stride + j) * 2 + 1] = y.imag();
+        }
+    }
+}
+
+/**
+ * @brief Broadcast the twiddle factors of a single butterfly to every
+ * butterfly of a radix-4 stage.
+ *
+ * @param twiddles
+ * @param stride
+ * @param j
+ * @return std::vector<float>
+ */
+inline std::vector<float> radix4_broadcast(const std::vector<float> &twiddles, unsigned stride, unsigned j) {
+    std::vector<float> broadcast;
+    for (unsigned t = 0; t < 3; t++) {
+        for (unsigned i = 0; i < stride; i++) {
+            broadcast.push_back(twiddles[(t * stride + j) * 2]);
+            broadcast.push_back(twiddles[(t * stride + j) * 2 + 1]);
+        }
+    }
+    return broadcast;
+}
@@ -145,4 +145,310 @@ TEST_CASE("Fourier transform benchmarks", "[Fourier]") {
         Dynamo::Fourier::inverse(signal0.data(), signal0.size());
         Dynamo::Fourier::inverse(signal1.data(), signal1.size());
     };
+}
+/**
+ * @brief Generate a deterministic real test signal.
+ *
+ * @param N
+ * @return std::vector<float>
+ */
+std::vector<float> real_signal(unsigned N) {
+    std::vector<float> signal(N);
+    for (unsigned i = 0; i < N; i++) {
+        signal[i] = std::sin(0.37 * i) + 0.5 * std::cos(1.91 * i + 0.2) - 0.25;
+    }
+    return signal;
+}
+
+TEST_CASE("Real Fourier transform", "[Fourier]") {
+    for (unsigned N = 2; N <= 4096; N <<= 1) {
+        std::vector<float> signal = real_signal(N);
+
+        std::vector<Dynamo::Complex> expected(signal.begin(), signal.end());
+        Dynamo::Fourier::transform(expected.data(), N);
+
+        std::vector<Dynamo::Complex> spectrum(N / 2 + 1);
+        Dynamo::Fourier::transform_real(signal.data(), spectrum.data(), N);
+
+        for (unsigned k = 0; k <= N / 2; k++) {
+            REQUIRE_THAT(spectrum[k].re, Approx(expected[k].re, 1e-5 * N));
+            REQUIRE_THAT(spectrum[k].im, Approx(expected[k].im, 1e-5 * N));
+        }
+    }
+}
+
+TEST_CASE("Inverse real Fourier transform", "[Fourier]") {
+    for (unsigned N = 2; N <= 4096; N <<= 1) {
+        std::vector<float> expected = real_signal(N);
+
+        std::vector<Dynamo::Complex> spectrum(expected.begin(), expected.end());
+        Dynamo::Fourier::transform(spectrum.data(), N);
+        spectrum.resize(N / 2 + 1);
+
+        std::vector<float> signal(N);
+        Dynamo::Fourier::inverse_real(spectrum.data(), signal.data(), N);
+
+        for (unsigned i = 0; i < N; i++) {
+            REQUIRE_THAT(signal[i], Approx(expected[i], 1e-4));
+        }
+    }
+}
+
+TEST_CASE("Real Fourier transform benchmarks", "[Fourier]") {
+    unsigned N = 512;
+    std::vector<float> signal = real_signal(N);
+    std::vector<Dynamo::Complex> complex_signal(N);
+    std::vector<Dynamo::Complex> spectrum(N / 2 + 1);
+    std::vector<Dynamo::Complex> signal_spectrum(N / 2 + 1);
+    Dynamo::Fourier::transform_real(signal.data(), signal_spectrum.data(), N);
+
+    BENCHMARK("Complex Fourier Transform 512 benchmark") {
+        std::copy(signal.begin(), signal.end(), complex_signal.begin());
+        Dynamo::Fourier::transform(complex_signal.data(), N);
+        return complex_signal[1];
+    };
+
+    BENCHMARK("Real Fourier Transform 512 benchmark") {
+        Dynamo::Fourier::transform_real(signal.data(), spectrum.data(), N);
+        return spectrum[1];
+    };
+
+    BENCHMARK("Inverse real Fourier Transform 512 benchmark") {
+        std::copy(signal_spectrum.begin(), signal_spectrum.end(), spectrum.begin());
+        Dynamo::Fourier::inverse_real(spectrum.data(), signal.data(), N);
+        return signal[1];
+    };
+}
+
+/**
+ * @brief Reference radix-2 transform with iteratively computed twiddle
+ * factors.
+ *
+ * @param signal
+ * @param N
+ */
+void reference_transform(Dynamo::Complex *signal, unsigned N) {
+    for (unsigned i = 1, j = 0; i < N; i++) {
+        unsigned bit = N >> 1;
+        while (bit & j) {
+            j ^= bit;
+            bit >>= 1;
+        }
+        j ^= bit;
+        if (i < j) {
+            std::swap(signal[i], signal[j]);
+        }
+    }
+    for (unsigned m = 2; m <= N; m <<= 1) {
+        unsigned half_m = m >> 1;
+        Dynamo::Complex omega_m = Dynamo::Complex(0, -2 * M_PI / m).exp();
+        for (unsigned k = 0; k < N; k += m) {
+            Dynamo::Complex omega(1);
+            for (unsigned j = 0; j < half_m; j++) {
+                Dynamo::Complex t = omega * signal[k + j + half_m];
+                Dynamo::Complex u = signal[k + j];
+                signal[k + j] = u + t;
+                signal[k + j + half_m] = u - t;
+                omega *= omega_m;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Check a transform against the DFT definition and its round trip.
+ *
+ * @param N
+ */
+void check_transform(unsigned N) {
+    std::vector<float> real = real_signal(N);
+    std::vector<Dynamo::Complex> signal(N);
+    for (unsigned i = 0; i < N; i++) {
+        signal[i] = Dynamo::Complex(real[i], real[N - 1 - i]);
+    }
+
+    // Compare against the DFT definition
+    std::vector<Dynamo::Complex> spectrum = signal;
+    Dynamo::Fourier::transform(spectrum.data(), N);
+    for (unsigned k = 0; k < N; k++) {
+        double re = 0;
+        double im = 0;
+        for (unsigned n = 0; n < N; n++) {
+            double angle = -2 * M_PI * ((static_cast<unsigned long>(k) * n) % N) / N;
+            re += signal[n].re * std::cos(angle) - signal[n].im * std::sin(angle);
+            im += signal[n].re * std::sin(angle) + signal[n].im * std::cos(angle);
+        }
+        REQUIRE_THAT(spectrum[k].re, Approx(re, 1e-4 * N));
+        REQUIRE_THAT(spectrum[k].im, Approx(im, 1e-4 * N));
+    }
+
+    // Round trip
+    Dynamo::Fourier::inverse(spectrum.data(), N);
+    for (unsigned i = 0; i < N; i++) {
+        REQUIRE_THAT(spectrum[i].re, Approx(signal[i].re, 1e-5));
+        REQUIRE_THAT(spectrum[i].im, Approx(signal[i].im, 1e-5));
+    }
+}
+
+TEST_CASE("Fourier transform plans", "[Fourier]") {
+    for (unsigned N = 1; N <= 1024; N <<= 1) {
+        check_transform(N);
+    }
+}
+
+TEST_CASE("Mixed-radix Fourier transform plans", "[Fourier]") {
+    for (unsigned N : {3, 5, 6, 9, 10, 12, 15, 20, 25, 30, 45, 60, 75, 96, 240, 360, 480, 720, 1000}) {
+        check_transform(N);
+        REQUIRE(Dynamo::Fourier::get_plan(N).scratch_size() == 0);
+    }
+}
+
+TEST_CASE("Bluestein Fourier transform plans", "[Fourier]") {
+    for (unsigned N : {7, 11, 13, 14, 49, 97, 147, 441, 882, 1021}) {
+        check_transform(N);
+        REQUIRE(Dynamo::Fourier::get_plan(N).scratch_size() >= 2 * N - 1);
+    }
+}
+
+TEST_CASE("Real Fourier transform of arbitrary lengths", "[Fourier]") {
+    for (unsigned N : {6, 10, 14, 30, 480, 882, 960}) {
+        std::vector<float> signal = real_signal(N);
+
+        std::vector<Dynamo::Complex> expected(signal.begin(), signal.end());
+        Dynamo::Fourier::transform(expected.data(), N);
+
+        std::vector<Dynamo::Complex> spectrum(N / 2 + 1);
+        Dynamo::Fourier::transform_real(signal.data(), spectrum.data(), N);
+        for (unsigned k = 0; k <= N / 2; k++) {
+            REQUIRE_THAT(spectrum[k].re, Approx(expected[k].re, 1e-5 * N));
+            REQUIRE_THAT(spectrum[k].im, Approx(expected[k].im, 1e-5 * N));
+        }
+
+        std::vector<float> result(N);
+        Dynamo::Fourier::inverse_real(spectrum.data(), result.data(), N);
+        for (unsigned i = 0; i < N; i++) {
+            REQUIRE_THAT(result[i], Approx(signal[i], 1e-4));
+        }
+    }
+}
+
+TEST_CASE("Fourier transform plan benchmarks", "[Fourier]") {
+    for (unsigned N = 64; N <= 65536; N <<= 1) {
+        std::vector<float> real = real_signal(N);
+        std::vector<Dynamo::Complex> input(real.begin(), real.end());
+        std::vector<Dynamo::Complex> signal(N);
+        const Dynamo::Fourier::Plan &plan = Dynamo::Fourier::get_plan(N);
+
+        BENCHMARK("Radix-2 Fourier Transform " + std::to_string(N) + " benchmark") {
+            std::copy(input.begin(), input.end(), signal.begin());
+            reference_transform(signal.data(), N);
+            return signal[1];
+        };
+
+        BENCHMARK("Planned Fourier Transform " + std::to_string(N) + " benchmark") {
+            std::copy(input.begin(), input.end(), signal.begin());
+            plan.transform(signal.data());
+            return signal[1];
+        };
+    }
+}
+
+TEST_CASE("Arbitrary length Fourier transform plan benchmarks", "[Fourier]") {
+    for (unsigned N : {441, 480, 512, 882, 960, 1024}) {
+        std::vector<float> real = real_signal(N);
+        std::vector<Dynamo::Complex> input(real.begin(), real.end());
+        std::vector<Dynamo::Complex> signal(N);
+        const Dynamo::Fourier::Plan &plan = Dynamo::Fourier::get_plan(N);
+        std::vector<Dynamo::Complex> scratch(plan.scratch_size());
+
+        BENCHMARK("Planned Fourier Transform " + std::to_string(N) + " benchmark") {
+            std::copy(input.begin(), input.end(), signal.begin());
+            plan.transform(signal.data(), scratch.data());
+            return signal[1];
+        };
+    }
+}
+
+/**
+ * @brief Generate K interleaved test signals of length N.
+ *
+ * @param N
+ * @param K
+ * @return std::vector<Dynamo::Complex>
+ */
+std::vector<Dynamo::Complex> batch_signals(unsigned N, unsigned K) {
+    std::vector<Dynamo::Complex> signals(N * K);
+    for (unsigned n = 0; n < N; n++) {
+        for (unsigned k = 0; k < K; k++) {
+            signals[n * K + k] = Dynamo::Complex(std::sin(0.37 * n + k), std::cos(1.91 * n * (k + 1)));
+        }
+    }
+    return signals;
+}
+
+TEST_CASE("Batched Fourier transform", "[Fourier]") {
+    Dynamo::ThreadPool pool(4);
+    for (unsigned N : {1, 2, 8, 64, 512, 480, 441}) {
+        for (unsigned K : {1, 3, 8, 17, 130}) {
+            std::vector<Dynamo::Complex> signals = batch_signals(N, K);
+
+            // Transform each signal on its own
+            std::vector<Dynamo::Complex> expected = signals;
+            std::vector<Dynamo::Complex> signal(N);
+            for (unsigned k = 0; k < K; k++) {
+                for (unsigned n = 0; n < N; n++) {
+                    signal[n] = signals[n * K + k];
+                }
+                Dynamo::Fourier::transform(signal.data(), N);
+                for (unsigned n = 0; n < N; n++) {
+                    expected[n * K + k] = signal[n];
+                }
+            }
+
+            for (Dynamo::ThreadPool *batch_pool : {static_cast<Dynamo::ThreadPool *>(nullptr), &pool}) {
+                std::vector<Dynamo::Complex> spectra = signals;
+                Dynamo::Fourier::transform_batch(spectra.data(), N, K, batch_pool);
+                for (unsigned i = 0; i < N * K; i++) {
+                    REQUIRE_THAT(spectra[i].re, Approx(expected[i].re, 1e-5 * N));
+                    REQUIRE_THAT(spectra[i].im, Approx(expected[i].im, 1e-5 * N));
+                }
+
+                Dynamo::Fourier::inverse_batch(spectra.data(), N, K, batch_pool);
+                for (unsigned i = 0; i < N * K; i++) {
+                    REQUIRE_THAT(spectra[i].re, Approx(signals[i].re, 1e-4));
+                    REQUIRE_THAT(spectra[i].im, Approx(signals[i].im, 1e-4));
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("Batched Fourier transform benchmarks", "[Fourier]") {
+    unsigned N = 512;
+    Dynamo::ThreadPool pool;
+    const Dynamo::Fourier::Plan &plan = Dynamo::Fourier::get_plan(N);
+    for (unsigned K = 1; K <= 512; K <<= 1) {
+        std::vector<Dynamo::Complex> input = batch_signals(N, K);
+        std::vector<Dynamo::Complex> signals(N * K);
+
+        BENCHMARK("Sequential Fourier Transform " + std::to_string(N) + "x" + std::to_string(K) + " benchmark") {
+            std::copy(input.begin(), input.end(), signals.begin());
+            for (unsigned k = 0; k < K; k++) {
+                plan.transform(signals.data() + k * N);
+            }
+            return signals[1];
+        };
+
+        BENCHMARK("Batched Fourier Transform " + std::to_string(N) + "x" + std::to_string(K) + " benchmark") {
+            std::copy(input.begin(), input.end(), signals.begin());
+            Dynamo::Fourier::transform_batch(signals.data(), N, K);
+            return signals[1];
+        };
+
+        BENCHMARK("Threaded batched Fourier Transform " + std::to_string(N) + "x" + std::to_string(K) + " benchmark") {
+            std::copy(input.begin(), input.end(), signals.begin());
+            Dynamo::Fourier::transform_batch(signals.data(), N, K, &pool);
+            return signals[1];
+        };
+    }
 }
\ No newline at end of file
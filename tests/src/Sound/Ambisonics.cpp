@@ -0,0 +1,353 @@
+#include <Dynamo.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "../Common.hpp"
+
+static constexpr unsigned CHUNKS = 8;
+
+/**
+ * @brief Generate a deterministic unit direction.
+ *
+ * @param i
+ * @return Dynamo::Vec3
+ */
+Dynamo::Vec3 make_direction(unsigned i) {
+    Dynamo::Vec3 direction(std::sin(1.3 * i + 0.2), std::cos(0.7 * i + 1), std::sin(2.1 * i + 0.5));
+    return direction / direction.length();
+}
+
+/**
+ * @brief Generate a deterministic pseudo-random mono chunk.
+ *
+ * @param seed
+ * @return Dynamo::Sound::Buffer
+ */
+Dynamo::Sound::Buffer make_noise(unsigned seed) {
+    Dynamo::Sound::Buffer noise(Dynamo::Sound::MAX_CHUNK_LENGTH, 1);
+    for (unsigned i = 0; i < noise.frames(); i++) {
+        seed = seed * 1103515245 + 12345;
+        noise[0][i] = static_cast<float>((seed >> 16) & 0x7fff) / 0x7fff - 0.5;
+    }
+    return noise;
+}
+
+/**
+ * @brief Legendre polynomial of degree l.
+ *
+ * @param l
+ * @param x
+ * @return double
+ */
+double legendre(unsigned l, double x) {
+    double p0 = 1;
+    double p1 = x;
+    if (l == 0) return p0;
+    for (unsigned n = 1; n < l; n++) {
+        double p2 = ((2 * n + 1) * x * p1 - n * p0) / (n + 1);
+        p0 = p1;
+        p1 = p2;
+    }
+    return p1;
+}
+
+/**
+ * @brief Decode a plane wave from a direction over several chunks.
+ *
+ * @param decoder
+ * @param direction
+ * @param rotation
+ * @return Dynamo::Sound::Buffer Binaural output of all chunks.
+ */
+Dynamo::Sound::Buffer decode_plane_wave(Dynamo::Sound::AmbisonicDecoder &decoder,
+                                        const Dynamo::Vec3 &direction,
+                                        const Dynamo::Quaternion &rotation) {
+    std::vector<float> coefficients(decoder.channels());
+    Dynamo::Sound::encode_ambisonic(direction, decoder.order(), coefficients.data());
+
+    Dynamo::Sound::Buffer output(CHUNKS * Dynamo::Sound::MAX_CHUNK_LENGTH, 2);
+    Dynamo::Sound::Buffer bus(Dynamo::Sound::MAX_CHUNK_LENGTH, decoder.channels());
+    Dynamo::Sound::Buffer chunk;
+    for (unsigned i = 0; i < CHUNKS; i++) {
+        Dynamo::Sound::Buffer noise = make_noise(i + 1);
+        for (unsigned c = 0; c < bus.channels(); c++) {
+            for (unsigned f = 0; f < bus.frames(); f++) {
+                bus[c][f] = coefficients[c] * noise[0][f];
+            }
+        }
+        decoder.decode(bus, chunk, rotation);
+        for (unsigned c = 0; c < 2; c++) {
+            std::copy(chunk[c], chunk[c] + chunk.frames(), output[c] + i * Dynamo::Sound::MAX_CHUNK_LENGTH);
+        }
+    }
+    return output;
+}
+
+/**
+ * @brief Compute the energy of a channel.
+ *
+ * @param buffer
+ * @param channel
+ * @return double
+ */
+double channel_energy(const Dynamo::Sound::Buffer &buffer, unsigned channel) {
+    double energy = 0;
+    for (unsigned i = 0; i < buffer.frames(); i++) {
+        energy += buffer[channel][i] * buffer[channel][i];
+    }
+    return energy;
+}
+
+TEST_CASE("Ambisonics encoding", "[Ambisonics]") {
+    REQUIRE(Dynamo::Sound::ambisonic_channels(1) == 4);
+    REQUIRE(Dynamo::Sound::ambisonic_channels(3) == 16);
+
+    // SN3D harmonics of each order satisfy the addition theorem
+    std::array<float, Dynamo::Sound::ambisonic_channels(Dynamo::Sound::MAX_AMBISONIC_ORDER)> a, b;
+    for (unsigned i = 0; i < 50; i++) {
+        Dynamo::Vec3 u = make_direction(i);
+        Dynamo::Vec3 v = make_direction(3 * i + 7);
+        Dynamo::Sound::encode_ambisonic(u, Dynamo::Sound::MAX_AMBISONIC_ORDER, a.data());
+        Dynamo::Sound::encode_ambisonic(v, Dynamo::Sound::MAX_AMBISONIC_ORDER, b.data());
+        for (unsigned l = 0; l <= Dynamo::Sound::MAX_AMBISONIC_ORDER; l++) {
+            double sum = 0;
+            for (unsigned n = l * l; n < (l + 1) * (l + 1); n++) {
+                sum += a[n] * b[n];
+            }
+            REQUIRE_THAT(sum, Approx(legendre(l, u * v), 1e-5));
+        }
+    }
+}
+
+TEST_CASE("Ambisonics decoder rotation", "[Ambisonics]") {
+    for (unsigned order : {1, 3}) {
+        Dynamo::Vec3 direction = make_direction(5);
+        Dynamo::Quaternion rotation(Dynamo::Vec3(0.3, 1, -0.2) / Dynamo::Vec3(0.3, 1, -0.2).length(), 1.1);
+
+        // Rotating the listener and the source together changes nothing
+        Dynamo::Sound::AmbisonicDecoder fixed(order);
+        Dynamo::Sound::AmbisonicDecoder rotated(order);
+        REQUIRE(fixed.speakers() >= fixed.channels());
+        Dynamo::Sound::Buffer expected = decode_plane_wave(fixed, direction, Dynamo::Quaternion());
+        Dynamo::Sound::Buffer output = decode_plane_wave(rotated, rotation.rotate(direction), rotation);
+        for (unsigned c = 0; c < 2; c++) {
+            for (unsigned i = 0; i < output.frames(); i++) {
+                REQUIRE_THAT(output[c][i], Approx(expected[c][i], 1e-4));
+            }
+        }
+    }
+}
+
+TEST_CASE("Ambisonics decoder superposition", "[Ambisonics]") {
+    for (unsigned order : {1, 3}) {
+        Dynamo::Vec3 u = make_direction(2);
+        Dynamo::Vec3 v = make_direction(9);
+
+        // Decoding a bus of two sources equals decoding each source
+        Dynamo::Sound::AmbisonicDecoder decoder_u(order);
+        Dynamo::Sound::AmbisonicDecoder decoder_v(order);
+        Dynamo::Sound::Buffer output_u = decode_plane_wave(decoder_u, u, Dynamo::Quaternion());
+        Dynamo::Sound::Buffer output_v = decode_plane_wave(decoder_v, v, Dynamo::Quaternion());
+
+        std::vector<float> coefficients_u(decoder_u.channels());
+        std::vector<float> coefficients_v(decoder_v.channels());
+        Dynamo::Sound::encode_ambisonic(u, order, coefficients_u.data());
+        Dynamo::Sound::encode_ambisonic(v, order, coefficients_v.data());
+
+        Dynamo::Sound::AmbisonicDecoder decoder(order);
+        Dynamo::Sound::Buffer bus(Dynamo::Sound::MAX_CHUNK_LENGTH, decoder.channels());
+        Dynamo::Sound::Buffer chunk;
+        for (unsigned i = 0; i < CHUNKS; i++) {
+            Dynamo::Sound::Buffer noise = make_noise(i + 1);
+            for (unsigned c = 0; c < bus.channels(); c++) {
+                for (unsigned f = 0; f < bus.frames(); f++) {
+                    bus[c][f] = (coefficients_u[c] + coefficients_v[c]) * noise[0][f];
+                }
+            }
+            decoder.decode(bus, chunk, Dynamo::Quaternion());
+            for (unsigned c = 0; c < 2; c++) {
+                for (unsigned f = 0; f < chunk.frames(); f++) {
+                    unsigned frame = i * Dynamo::Sound::MAX_CHUNK_LENGTH + f;
+                    REQUIRE_THAT(chunk[c][f], Approx(output_u[c][frame] + output_v[c][frame], 1e-4));
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Render a source through the ambisonic bus of an offline Jukebox.
+ *
+ * @param clip
+ * @param order    Ambisonic order, or 0 to mix the source directly.
+ * @param position Source position.
+ * @param rotation Listener rotation.
+ * @return Dynamo::Sound::Buffer
+ */
+Dynamo::Sound::Buffer render_ambisonic(const Dynamo::Sound::Buffer &clip,
+                                       unsigned order,
+                                       const Dynamo::Vec3 &position,
+                                       const Dynamo::Quaternion &rotation) {
+    Dynamo::Sound::Jukebox jukebox({2, 44100});
+    jukebox.set_ambisonic_order(order);
+    jukebox.listener().rotation = rotation;
+
+    Dynamo::Sound::Source source(clip);
+    source.position = position;
+    source.set_ambisonic(true);
+    jukebox.play(source);
+
+    Dynamo::Sound::Buffer mix;
+    jukebox.render(mix, clip.frames());
+    return mix;
+}
+
+TEST_CASE("Ambisonics Jukebox bus", "[Ambisonics]") {
+    Dynamo::Sound::Buffer clip(CHUNKS * Dynamo::Sound::MAX_CHUNK_LENGTH, 1);
+    for (unsigned i = 0; i < CHUNKS; i++) {
+        Dynamo::Sound::Buffer noise = make_noise(i + 1);
+        std::copy(noise[0], noise[0] + noise.frames(), clip[0] + i * Dynamo::Sound::MAX_CHUNK_LENGTH);
+    }
+
+    Dynamo::Sound::Jukebox jukebox({2, 44100});
+    REQUIRE(jukebox.get_ambisonic_order() == 0);
+    jukebox.set_ambisonic_order(3);
+    REQUIRE(jukebox.get_ambisonic_order() == 3);
+
+    // The bus follows the listener rotation
+    Dynamo::Vec3 position(4, 1, -2);
+    Dynamo::Quaternion rotation(Dynamo::Vec3(0, 1, 0), 0.8);
+    Dynamo::Sound::Buffer expected = render_ambisonic(clip, 3, position, Dynamo::Quaternion());
+    Dynamo::Sound::Buffer rotated = render_ambisonic(clip, 3, rotation.rotate(position), rotation);
+    for (unsigned c = 0; c < 2; c++) {
+        for (unsigned i = 0; i < clip.frames(); i++) {
+            REQUIRE_THAT(rotated[c][i], Approx(expected[c][i], 1e-4));
+        }
+    }
+
+    // Without a bus, the source is mixed onto both channels unchanged
+    Dynamo::Sound::Buffer direct = render_ambisonic(clip, 0, position, Dynamo::Quaternion());
+    for (unsigned i = 0; i < clip.frames(); i++) {
+        REQUIRE(direct[0][i] == direct[1][i]);
+    }
+    REQUIRE(channel_energy(expected, 0) != channel_energy(expected, 1));
+}
+
+TEST_CASE("Ambisonics Jukebox restart", "[Ambisonics]") {
+    Dynamo::Sound::Buffer clip(CHUNKS * Dynamo::Sound::MAX_CHUNK_LENGTH, 1);
+    for (unsigned i = 0; i < CHUNKS; i++) {
+        Dynamo::Sound::Buffer noise = make_noise(i + 1);
+        std::copy(noise[0], noise[0] + noise.frames(), clip[0] + i * Dynamo::Sound::MAX_CHUNK_LENGTH);
+    }
+    Dynamo::Vec3 position(4, 1, -2);
+    Dynamo::Sound::Buffer expected = render_ambisonic(clip, 3, position, Dynamo::Quaternion());
+
+    Dynamo::Sound::Jukebox jukebox({2, 44100});
+    jukebox.set_ambisonic_order(3);
+    Dynamo::Sound::Source source(clip);
+    source.position = position;
+    source.set_ambisonic(true);
+    jukebox.play(source);
+
+    // The HRIR tails drain while nothing plays
+    Dynamo::Sound::Buffer mix;
+    jukebox.render(mix, clip.frames());
+    jukebox.render(mix, clip.frames());
+    REQUIRE(!source.is_playing());
+    REQUIRE(channel_energy(mix, 0) > 0);
+    jukebox.render(mix, clip.frames());
+    for (unsigned c = 0; c < 2; c++) {
+        REQUIRE(channel_energy(mix, c) == 0);
+    }
+
+    // Playing again sounds the same as on a fresh Jukebox
+    source.seek(Dynamo::Seconds(0));
+    jukebox.play(source);
+    jukebox.render(mix, clip.frames());
+    for (unsigned c = 0; c < 2; c++) {
+        for (unsigned i = 0; i < clip.frames(); i++) {
+            REQUIRE_THAT(mix[c][i], Approx(expected[c][i], 1e-5));
+        }
+    }
+}
+
+TEST_CASE("Ambisonics Jukebox order change", "[Ambisonics]") {
+    Dynamo::Sound::Buffer noise = make_noise(1);
+    Dynamo::Sound::Jukebox jukebox({2, 44100});
+    Dynamo::Sound::Source source(noise);
+    source.position = Dynamo::Vec3(4, 1, -2);
+    source.set_ambisonic(true);
+
+    // Change the order while another thread renders
+    std::atomic<bool> done = false;
+    std::thread renderer([&]() {
+        Dynamo::Sound::Buffer mix;
+        for (unsigned i = 0; i < 200; i++) {
+            if (!source.is_playing()) {
+                source.seek(Dynamo::Seconds(0));
+                jukebox.play(source);
+            }
+            jukebox.render(mix, Dynamo::Sound::MAX_CHUNK_LENGTH);
+        }
+        done = true;
+    });
+    unsigned order = 0;
+    while (!done) {
+        order = (order + 1) % (Dynamo::Sound::MAX_AMBISONIC_ORDER + 1);
+        jukebox.set_ambisonic_order(order);
+    }
+    renderer.join();
+    REQUIRE(jukebox.get_ambisonic_order() == order);
+}
+
+TEST_CASE("Ambisonics benchmarks", "[Ambisonics]") {
+    Dynamo::Sound::Buffer noise = make_noise(1);
+    Dynamo::Sound::Listener listener;
+    Dynamo::Sound::Buffer chunk;
+
+    // Encoding every source and decoding the bus once
+    for (unsigned order : {1, 3}) {
+        Dynamo::Sound::AmbisonicDecoder decoder(order);
+        Dynamo::Sound::Buffer bus(Dynamo::Sound::MAX_CHUNK_LENGTH, decoder.channels());
+        std::vector<float> coefficients(decoder.channels());
+        for (unsigned sources : {10, 100, 1000}) {
+            std::string name = "order " + std::to_string(order) + " " + std::to_string(sources) + " sources";
+            BENCHMARK("Ambisonics " + name + " chunk benchmark") {
+                bus.silence();
+                for (unsigned s = 0; s < sources; s++) {
+                    Dynamo::Sound::encode_ambisonic(make_direction(s), order, coefficients.data());
+                    for (unsigned c = 0; c < bus.channels(); c++) {
+                        Dynamo::Vectorize::vsma(noise[0], coefficients[c], bus[c], bus.frames());
+                    }
+                }
+                decoder.decode(bus, chunk, listener.rotation);
+                return chunk[0][1];
+            };
+        }
+    }
+
+    // Convolving every source with its own HRIR
+    for (unsigned sources : {10, 100}) {
+        std::vector<Dynamo::Sound::Binaural> filters(sources);
+        std::vector<std::unique_ptr<Dynamo::Sound::Source>> voices;
+        for (unsigned s = 0; s < sources; s++) {
+            voices.emplace_back(std::make_unique<Dynamo::Sound::Source>(noise));
+            // Keep to the upper hemisphere, where every HRTF point triangulates
+            Dynamo::Vec3 direction = make_direction(s);
+            direction.y = std::abs(direction.y);
+            voices.back()->position = direction;
+        }
+
+        Dynamo::Sound::Buffer mix(Dynamo::Sound::MAX_CHUNK_LENGTH, 2);
+        BENCHMARK("Binaural " + std::to_string(sources) + " sources chunk benchmark") {
+            mix.silence();
+            for (unsigned s = 0; s < sources; s++) {
+                filters[s].apply(noise, chunk, *voices[s], listener);
+                for (unsigned c = 0; c < 2; c++) {
+                    Dynamo::Vectorize::vadd(chunk[c], mix[c], mix[c], mix.frames());
+                }
+            }
+            return mix[0][1];
+        };
+    }
+}
\ No newline at end of file
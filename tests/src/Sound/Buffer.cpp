@@ -97,6 +97,81 @@ TEST_CASE("Buffer resize", "[Buffer]") {
     REQUIRE(buffer.channels() == 2);
 }
 
+TEST_CASE("Buffer shared storage", "[Buffer]") {
+    std::array<float, 6> arr = {3, 2, 1, 0, -1, 4};
+    Dynamo::Sound::Buffer buffer(arr.data(), 3, 2);
+    REQUIRE(!buffer.shared());
+
+    // Copies share the samples
+    Dynamo::Sound::Buffer copy = buffer;
+    const Dynamo::Sound::Buffer &view = copy;
+    REQUIRE(buffer.shared());
+    REQUIRE(copy.shared());
+    REQUIRE(view.data() == std::as_const(buffer).data());
+
+    // Writing to a copy does not affect the original
+    copy[1][2] = 7;
+    REQUIRE(!buffer.shared());
+    REQUIRE(!copy.shared());
+    REQUIRE(view.data() != std::as_const(buffer).data());
+    REQUIRE(buffer[1][2] == 4);
+    REQUIRE(copy[1][2] == 7);
+    for (unsigned i = 0; i < 5; i++) {
+        REQUIRE(copy.data()[i] == arr[i]);
+    }
+
+    // Resizing a shared buffer does not affect the original
+    copy = buffer;
+    copy.resize(2, 1);
+    copy.silence();
+    REQUIRE(buffer.frames() == 3);
+    REQUIRE(buffer[0][0] == 3);
+}
+
+TEST_CASE("Buffer move", "[Buffer]") {
+    std::array<float, 6> arr = {3, 2, 1, 0, -1, 4};
+    Dynamo::Sound::Buffer buffer(arr.data(), 3, 2);
+    const float *samples = std::as_const(buffer).data();
+
+    // Moves transfer the samples without copying
+    Dynamo::Sound::Buffer moved = std::move(buffer);
+    REQUIRE(std::as_const(moved).data() == samples);
+    REQUIRE(moved.frames() == 3);
+    REQUIRE(moved.channels() == 2);
+    REQUIRE(buffer.frames() == 0);
+    REQUIRE(buffer.channels() == 0);
+
+    buffer = std::move(moved);
+    REQUIRE(std::as_const(buffer).data() == samples);
+    REQUIRE(buffer[1][2] == 4);
+    REQUIRE(moved.frames() == 0);
+
+    // A moved-from buffer can be reused
+    moved.resize(4, 1);
+    moved.silence();
+    REQUIRE(moved[0][3] == 0);
+}
+
+TEST_CASE("Buffer external storage", "[Buffer]") {
+    bool released = false;
+    std::array<float, 6> arr = {3, 2, 1, 0, -1, 4};
+    {
+        // View the samples without copying them
+        std::shared_ptr<float[]> store(arr.data(), [&released](float *) { released = true; });
+        Dynamo::Sound::Buffer buffer(store, 3, 2);
+        store.reset();
+        REQUIRE(std::as_const(buffer).data() == arr.data());
+        REQUIRE(std::as_const(buffer)[1][2] == 4);
+
+        // Writes to a shared view detach from the storage
+        Dynamo::Sound::Buffer copy = buffer;
+        copy[0][0] = 7;
+        REQUIRE(arr[0] == 3);
+        REQUIRE(!released);
+    }
+    REQUIRE(released);
+}
+
 TEST_CASE("Buffer channel index", "[Buffer]") {
     std::array<float, 6> arr = {3, 2, 1, 0, -1, 4};
     Dynamo::Sound::Buffer buffer(arr.data(), 3, 2);
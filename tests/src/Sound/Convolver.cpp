@@ -0,0 +1,272 @@
+#include <Dynamo.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "../Common.hpp"
+
+static constexpr unsigned IR_LENGTH = 600;
+static constexpr unsigned CHUNKS = 8;
+
+/**
+ * @brief Generate a deterministic pseudo-random signal.
+ *
+ * @param length
+ * @param seed
+ * @return std::vector<Dynamo::Sound::WaveSample>
+ */
+std::vector<Dynamo::Sound::WaveSample> make_signal(unsigned length, unsigned seed) {
+    std::vector<Dynamo::Sound::WaveSample> signal(length);
+    for (unsigned i = 0; i < length; i++) {
+        seed = seed * 1103515245 + 12345;
+        signal[i] = static_cast<float>((seed >> 16) & 0x7fff) / 0x7fff - 0.5;
+    }
+    return signal;
+}
+
+/**
+ * @brief Reference time-domain convolution.
+ *
+ * @param x
+ * @param h
+ * @param n
+ * @return Dynamo::Sound::WaveSample
+ */
+Dynamo::Sound::WaveSample direct_convolve(const std::vector<Dynamo::Sound::WaveSample> &x,
+                                          const std::vector<Dynamo::Sound::WaveSample> &h,
+                                          unsigned n) {
+    Dynamo::Sound::WaveSample sum = 0;
+    for (unsigned k = 0; k < h.size() && k <= n; k++) {
+        sum += h[k] * x[n - k];
+    }
+    return sum;
+}
+
+/**
+ * @brief Reference convolver with a linear frequency delay-line that is
+ * shifted every block, a scalar complex multiply-accumulate and a complex
+ * FFT.
+ *
+ */
+struct LinearConvolver {
+    std::vector<Dynamo::Sound::WaveSample> input;
+    std::vector<Dynamo::Complex> output;
+    std::vector<Dynamo::Complex> fdl;
+    std::vector<Dynamo::Complex> partitions;
+    unsigned partition_count;
+
+    LinearConvolver(const std::vector<Dynamo::Sound::WaveSample> &ir) {
+        using namespace Dynamo::Sound;
+        partition_count = Convolver::partition_count(ir.size());
+        partitions.resize(partition_count * BLOCK_LENGTH_2, 0);
+        for (unsigned i = 0; i < partition_count; i++) {
+            std::copy(ir.begin() + i * BLOCK_LENGTH,
+                      ir.begin() + std::min<unsigned>((i + 1) * BLOCK_LENGTH, ir.size()),
+                      partitions.begin() + i * BLOCK_LENGTH_2);
+            Dynamo::Fourier::transform(partitions.data() + i * BLOCK_LENGTH_2, BLOCK_LENGTH_2);
+        }
+        input.resize(BLOCK_LENGTH_2, 0);
+        output.resize(BLOCK_LENGTH_2);
+        fdl.resize(partitions.size());
+    }
+
+    void compute(Dynamo::Sound::WaveSample *src, Dynamo::Sound::WaveSample *dst, unsigned N) {
+        using namespace Dynamo::Sound;
+        std::copy(input.begin() + BLOCK_LENGTH, input.end(), input.begin());
+        std::copy(src, src + N, input.begin() + BLOCK_LENGTH);
+        std::fill(input.begin() + BLOCK_LENGTH + N, input.end(), 0);
+
+        std::copy_backward(fdl.begin(), fdl.end() - BLOCK_LENGTH_2, fdl.end());
+        std::copy(input.begin(), input.end(), fdl.begin());
+        Dynamo::Fourier::transform(fdl.data(), BLOCK_LENGTH_2);
+
+        std::fill(output.begin(), output.end(), 0);
+        for (unsigned i = 0; i < partitions.size(); i++) {
+            output[i % BLOCK_LENGTH_2] += fdl[i] * partitions[i];
+        }
+        Dynamo::Fourier::inverse(output.data(), output.size());
+        for (unsigned i = 0; i < N; i++) {
+            dst[i] = output[i + BLOCK_LENGTH].re;
+        }
+    }
+};
+
+TEST_CASE("Convolver circular delay-line", "[Convolver]") {
+    using namespace Dynamo::Sound;
+
+    std::vector<Dynamo::Sound::WaveSample> input = make_signal(CHUNKS * BLOCK_LENGTH, 1);
+    std::vector<Dynamo::Sound::WaveSample> dst(BLOCK_LENGTH);
+    std::vector<Dynamo::Sound::WaveSample> expected(BLOCK_LENGTH);
+    for (unsigned partitions : {1, 2, 3, 8, 64}) {
+        std::vector<Dynamo::Sound::WaveSample> ir = make_signal(partitions * BLOCK_LENGTH, partitions);
+        LinearConvolver reference(ir);
+        Convolver convolver;
+        convolver.initialize(ir.data(), ir.size());
+
+        for (unsigned chunk = 0; chunk < CHUNKS; chunk++) {
+            Dynamo::Sound::WaveSample *src = input.data() + chunk * BLOCK_LENGTH;
+            reference.compute(src, expected.data(), BLOCK_LENGTH);
+            convolver.compute(src, dst.data(), BLOCK_LENGTH);
+            for (unsigned i = 0; i < BLOCK_LENGTH; i++) {
+                REQUIRE_THAT(dst[i], Approx(expected[i], 1e-3));
+            }
+        }
+    }
+}
+
+TEST_CASE("Convolver circular delay-line benchmarks", "[Convolver]") {
+    using namespace Dynamo::Sound;
+
+    std::vector<Dynamo::Sound::WaveSample> input = make_signal(BLOCK_LENGTH, 1);
+    std::vector<Dynamo::Sound::WaveSample> dst(BLOCK_LENGTH);
+    for (unsigned partitions : {1, 2, 4, 8, 16, 32, 64}) {
+        std::vector<Dynamo::Sound::WaveSample> ir = make_signal(partitions * BLOCK_LENGTH, partitions);
+        LinearConvolver reference(ir);
+        Convolver convolver;
+        convolver.initialize(ir.data(), ir.size());
+
+        BENCHMARK("Convolver linear " + std::to_string(partitions) + " benchmark") {
+            reference.compute(input.data(), dst.data(), BLOCK_LENGTH);
+            return dst[0];
+        };
+
+        BENCHMARK("Convolver circular " + std::to_string(partitions) + " benchmark") {
+            convolver.compute(input.data(), dst.data(), BLOCK_LENGTH);
+            return dst[0];
+        };
+    }
+}
+
+TEST_CASE("Convolver multiple outputs", "[Convolver]") {
+    using namespace Dynamo::Sound;
+
+    std::vector<Dynamo::Sound::WaveSample> input = make_signal(CHUNKS * BLOCK_LENGTH, 1);
+    std::vector<Dynamo::Sound::WaveSample> ir0 = make_signal(IR_LENGTH, 2);
+    std::vector<Dynamo::Sound::WaveSample> ir1 = make_signal(IR_LENGTH, 3);
+
+    unsigned partition_count = Convolver::partition_count(IR_LENGTH);
+    unsigned partition_length = partition_count * BLOCK_BINS;
+    std::vector<Dynamo::Complex> partitions(2 * partition_length);
+    Convolver::transform_partitions(ir0.data(), IR_LENGTH, partitions.data());
+    Convolver::transform_partitions(ir1.data(), IR_LENGTH, partitions.data() + partition_length);
+
+    Convolver shared;
+    shared.initialize(partitions.data(), partition_count, 2);
+
+    Convolver single;
+    single.initialize(ir1.data(), IR_LENGTH);
+
+    Buffer dst(BLOCK_LENGTH, 2);
+    std::vector<Dynamo::Sound::WaveSample> single_dst(BLOCK_LENGTH);
+    for (unsigned chunk = 0; chunk < CHUNKS; chunk++) {
+        Dynamo::Sound::WaveSample *src = input.data() + chunk * BLOCK_LENGTH;
+        shared.compute(src, dst, BLOCK_LENGTH);
+        single.compute(src, single_dst.data(), BLOCK_LENGTH);
+
+        for (unsigned i = 0; i < BLOCK_LENGTH; i++) {
+            unsigned n = chunk * BLOCK_LENGTH + i;
+            REQUIRE_THAT(dst[0][i], Approx(direct_convolve(input, ir0, n), 1e-3));
+            REQUIRE_THAT(dst[1][i], Approx(direct_convolve(input, ir1, n), 1e-3));
+            REQUIRE_THAT(dst[1][i], Approx(single_dst[i], 1e-5));
+        }
+    }
+}
+
+TEST_CASE("Convolver multiple outputs benchmarks", "[Convolver]") {
+    using namespace Dynamo::Sound;
+
+    std::vector<Dynamo::Sound::WaveSample> input = make_signal(BLOCK_LENGTH, 1);
+    std::vector<Dynamo::Sound::WaveSample> ir = make_signal(IR_LENGTH, 2);
+
+    unsigned partition_count = Convolver::partition_count(IR_LENGTH);
+    unsigned partition_length = partition_count * BLOCK_BINS;
+    std::vector<Dynamo::Complex> partitions(2 * partition_length);
+    Convolver::transform_partitions(ir.data(), IR_LENGTH, partitions.data());
+    Convolver::transform_partitions(ir.data(), IR_LENGTH, partitions.data() + partition_length);
+
+    std::array<Convolver, 2> separate;
+    separate[0].initialize(ir.data(), IR_LENGTH);
+    separate[1].initialize(ir.data(), IR_LENGTH);
+
+    Convolver shared;
+    shared.initialize(partitions.data(), partition_count, 2);
+
+    Buffer dst(BLOCK_LENGTH, 2);
+
+    BENCHMARK("Convolver separate stereo benchmark") {
+        separate[0].compute(input.data(), dst[0], BLOCK_LENGTH);
+        separate[1].compute(input.data(), dst[1], BLOCK_LENGTH);
+        return dst[1][0];
+    };
+
+    BENCHMARK("Convolver shared stereo benchmark") {
+        shared.compute(input.data(), dst, BLOCK_LENGTH);
+        return dst[1][0];
+    };
+}
+
+TEST_CASE("NonUniformConvolver long impulse response", "[Convolver]") {
+    using namespace Dynamo::Sound;
+
+    unsigned ir_length = 40000;
+    unsigned chunks = 200;
+    std::vector<Dynamo::Sound::WaveSample> input = make_signal(chunks * BLOCK_LENGTH, 1);
+    std::vector<Dynamo::Sound::WaveSample> ir = make_signal(ir_length, 2);
+
+    Convolver uniform;
+    uniform.initialize(ir.data(), ir_length);
+
+    Dynamo::ThreadPool pool(2);
+    NonUniformConvolver inline_convolver;
+    NonUniformConvolver pool_convolver(&pool);
+    inline_convolver.initialize(ir.data(), ir_length);
+    pool_convolver.initialize(ir.data(), ir_length);
+
+    std::vector<Dynamo::Sound::WaveSample> expected(BLOCK_LENGTH);
+    std::vector<Dynamo::Sound::WaveSample> inline_dst(BLOCK_LENGTH);
+    std::vector<Dynamo::Sound::WaveSample> pool_dst(BLOCK_LENGTH);
+    for (unsigned chunk = 0; chunk < chunks; chunk++) {
+        Dynamo::Sound::WaveSample *src = input.data() + chunk * BLOCK_LENGTH;
+        uniform.compute(src, expected.data(), BLOCK_LENGTH);
+        inline_convolver.compute(src, inline_dst.data(), BLOCK_LENGTH);
+        pool_convolver.compute(src, pool_dst.data(), BLOCK_LENGTH);
+
+        for (unsigned i = 0; i < BLOCK_LENGTH; i++) {
+            REQUIRE_THAT(inline_dst[i], Approx(expected[i], 1e-2));
+            REQUIRE(pool_dst[i] == inline_dst[i]);
+        }
+    }
+}
+
+TEST_CASE("NonUniformConvolver benchmarks", "[Convolver]") {
+    using namespace Dynamo::Sound;
+
+    unsigned ir_length = 88200;
+    std::vector<Dynamo::Sound::WaveSample> input = make_signal(BLOCK_LENGTH, 1);
+    std::vector<Dynamo::Sound::WaveSample> ir = make_signal(ir_length, 2);
+    std::vector<Dynamo::Sound::WaveSample> dst(BLOCK_LENGTH);
+
+    Convolver uniform;
+    uniform.initialize(ir.data(), ir_length);
+
+    NonUniformConvolver non_uniform;
+    non_uniform.initialize(ir.data(), ir_length);
+
+    Dynamo::ThreadPool pool(1);
+    NonUniformConvolver pool_convolver(&pool);
+    pool_convolver.initialize(ir.data(), ir_length);
+
+    BENCHMARK("Convolver uniform 2s benchmark") {
+        uniform.compute(input.data(), dst.data(), BLOCK_LENGTH);
+        return dst[0];
+    };
+
+    BENCHMARK("NonUniformConvolver in-line 2s benchmark") {
+        non_uniform.compute(input.data(), dst.data(), BLOCK_LENGTH);
+        return dst[0];
+    };
+
+    BENCHMARK("NonUniformConvolver thread pool 2s benchmark") {
+        pool_convolver.compute(input.data(), dst.data(), BLOCK_LENGTH);
+        return dst[0];
+    };
+}
@@ -0,0 +1,87 @@
+#include <Dynamo.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "../Common.hpp"
+
+/**
+ * @brief Reference triangle lookup by scanning every triangle.
+ *
+ * @param point
+ * @return Dynamo::Sound::HRIRWeights
+ */
+Dynamo::Sound::HRIRWeights scan_weights(const Dynamo::Vec2 &point) {
+    const auto &points = Dynamo::Sound::HRTF_POINTS;
+    const auto &indices = Dynamo::Sound::HRTF_INDICES;
+    for (unsigned t = 0; t < indices.size(); t += 3) {
+        unsigned a = indices[t];
+        unsigned b = indices[t + 1];
+        unsigned c = indices[t + 2];
+
+        Dynamo::Triangle2 triangle(points[a], points[b], points[c]);
+        Dynamo::Vec3 coords = triangle.barycentric(point);
+
+        float eps = 1e-6;
+        if (coords.x >= -eps && coords.y >= -eps && coords.z >= -eps) {
+            return {{a, b, c}, coords};
+        }
+    }
+    return {};
+}
+
+/**
+ * @brief Generate a grid of sample points in the azimuth-elevation space.
+ *
+ * @return std::vector<Dynamo::Vec2>
+ */
+std::vector<Dynamo::Vec2> sample_points() {
+    std::vector<Dynamo::Vec2> samples;
+    for (float az = -89.5; az < 90; az += 7.3) {
+        for (float el = -89.5; el < 270; el += 3.1) {
+            samples.emplace_back(az, el);
+        }
+    }
+    return samples;
+}
+
+TEST_CASE("HRTF grid lookup", "[HRTF]") {
+    const Dynamo::Sound::HRTF &hrtf = Dynamo::Sound::HRTF::get();
+    REQUIRE(&hrtf == &Dynamo::Sound::HRTF::get());
+    for (const Dynamo::Vec2 &point : sample_points()) {
+        Dynamo::Sound::HRIRWeights weights = hrtf.calculate_weights(point);
+
+        // The point must be contained by the triangle
+        REQUIRE(weights.coords.x >= -1e-6);
+        REQUIRE(weights.coords.y >= -1e-6);
+        REQUIRE(weights.coords.z >= -1e-6);
+        REQUIRE_THAT(weights.coords.x + weights.coords.y + weights.coords.z, Approx(1, 1e-5));
+
+        // Interpolating the triangle vertices must recover the point
+        const auto &points = Dynamo::Sound::HRTF_POINTS;
+        Dynamo::Vec2 p = points[weights.indices[0]] * weights.coords.x + points[weights.indices[1]] * weights.coords.y +
+                         points[weights.indices[2]] * weights.coords.z;
+        REQUIRE_THAT(p.x, Approx(point.x, 1e-3));
+        REQUIRE_THAT(p.y, Approx(point.y, 1e-3));
+    }
+}
+
+TEST_CASE("HRTF grid lookup benchmarks", "[HRTF]") {
+    const Dynamo::Sound::HRTF &hrtf = Dynamo::Sound::HRTF::get();
+    std::vector<Dynamo::Vec2> points = sample_points();
+
+    BENCHMARK("HRTF triangle scan benchmark") {
+        float sum = 0;
+        for (const Dynamo::Vec2 &point : points) {
+            sum += scan_weights(point).coords.x;
+        }
+        return sum;
+    };
+
+    BENCHMARK("HRTF triangle grid benchmark") {
+        float sum = 0;
+        for (const Dynamo::Vec2 &point : points) {
+            sum += hrtf.calculate_weights(point).coords.x;
+        }
+        return sum;
+    };
+}
@@ -0,0 +1,253 @@
+#include <Dynamo.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "../Common.hpp"
+
+static constexpr unsigned VOICE_LENGTH = 3000;
+
+/**
+ * @brief Generate a deterministic mono voice.
+ *
+ * @param frequency Angular frequency in radians per frame.
+ * @return Dynamo::Sound::Buffer
+ */
+Dynamo::Sound::Buffer make_voice(double frequency) {
+    Dynamo::Sound::Buffer voice(VOICE_LENGTH, 1);
+    for (unsigned i = 0; i < VOICE_LENGTH; i++) {
+        voice[0][i] = 0.05 * std::sin(frequency * i);
+    }
+    return voice;
+}
+
+/**
+ * @brief Render voices on a new offline Jukebox.
+ *
+ * @param output
+ * @param voices
+ * @param lengths     Number of frames to render on each call.
+ * @param mix_threads
+ * @param composite_resampling
+ * @return Dynamo::Sound::Buffer
+ */
+Dynamo::Sound::Buffer render_voices(const Dynamo::Sound::OfflineOutput &output,
+                                    const std::vector<Dynamo::Sound::Buffer> &voices,
+                                    const std::vector<unsigned> &lengths,
+                                    unsigned mix_threads = 0,
+                                    bool composite_resampling = false) {
+    Dynamo::Sound::Jukebox jukebox(output, mix_threads);
+    jukebox.set_composite_resampling(composite_resampling);
+    std::vector<std::unique_ptr<Dynamo::Sound::Source>> sources;
+    for (const Dynamo::Sound::Buffer &voice : voices) {
+        sources.emplace_back(std::make_unique<Dynamo::Sound::Source>(voice));
+        jukebox.play(*sources.back());
+    }
+
+    unsigned frames = 0;
+    for (unsigned length : lengths) {
+        frames += length;
+    }
+    Dynamo::Sound::Buffer mix(frames, output.channels);
+    Dynamo::Sound::Buffer chunk;
+    unsigned offset = 0;
+    for (unsigned length : lengths) {
+        jukebox.render(chunk, length);
+        for (unsigned c = 0; c < output.channels; c++) {
+            std::copy(chunk[c], chunk[c] + length, mix[c] + offset);
+        }
+        offset += length;
+    }
+    REQUIRE(jukebox.stats().output_overruns == 0);
+    return mix;
+}
+
+TEST_CASE("Jukebox offline render", "[Jukebox]") {
+    Dynamo::Sound::Buffer voice = make_voice(0.05);
+    Dynamo::Sound::Jukebox jukebox({2, 44100});
+    REQUIRE(jukebox.devices().empty());
+    REQUIRE(!jukebox.is_playing());
+
+    bool finished = false;
+    Dynamo::Sound::Source source(voice);
+    source.set_on_finish([&finished]() { finished = true; });
+    jukebox.play(source);
+
+    // The mono voice is upmixed to both channels
+    Dynamo::Sound::Buffer mix;
+    jukebox.render(mix, 2 * VOICE_LENGTH);
+    REQUIRE(mix.frames() == 2 * VOICE_LENGTH);
+    REQUIRE(mix.channels() == 2);
+    for (unsigned i = 0; i < VOICE_LENGTH; i++) {
+        REQUIRE_THAT(mix[0][i], Approx(voice[0][i], 1e-3));
+        REQUIRE(mix[1][i] == mix[0][i]);
+    }
+
+    // The source finishes and the rest of the mix is silent
+    REQUIRE(finished);
+    REQUIRE(!source.is_playing());
+    Dynamo::Sound::Buffer tail;
+    jukebox.render(tail, 1000);
+    for (unsigned i = 0; i < tail.frames(); i++) {
+        REQUIRE(tail[0][i] == 0);
+    }
+}
+
+TEST_CASE("Jukebox offline render lengths", "[Jukebox]") {
+    std::vector<Dynamo::Sound::Buffer> voices = {make_voice(0.05), make_voice(0.3)};
+    for (double rate : {44100.0, 48000.0}) {
+        Dynamo::Sound::OfflineOutput output = {2, rate};
+
+        // The mix does not depend on how the frames are split between renders
+        Dynamo::Sound::Buffer whole = render_voices(output, voices, {4000});
+        Dynamo::Sound::Buffer split = render_voices(output, voices, {1, 700, 255, 3044});
+        for (unsigned c = 0; c < 2; c++) {
+            for (unsigned i = 0; i < 4000; i++) {
+                REQUIRE(split[c][i] == whole[c][i]);
+            }
+        }
+    }
+}
+
+TEST_CASE("Jukebox offline render channels", "[Jukebox]") {
+    std::vector<Dynamo::Sound::Buffer> voices = {make_voice(0.05), make_voice(0.3)};
+    Dynamo::Sound::Buffer stereo = render_voices({2, 48000}, voices, {4000}, 0, true);
+
+    // Channel counts too large for the output ring buffer render losslessly
+    for (unsigned channels : {32, 40, 80}) {
+        Dynamo::Sound::Buffer mix = render_voices({channels, 48000}, voices, {1, 700, 255, 3044}, 0, true);
+        REQUIRE(mix.channels() == channels);
+        for (unsigned i = 0; i < 4000; i++) {
+            REQUIRE(mix[0][i] == stereo[0][i]);
+            for (unsigned c = 1; c < channels; c++) {
+                REQUIRE(mix[c][i] == 0);
+            }
+        }
+    }
+}
+
+TEST_CASE("Jukebox offline mix threads", "[Jukebox]") {
+    std::vector<Dynamo::Sound::Buffer> voices;
+    for (unsigned v = 0; v < 40; v++) {
+        voices.emplace_back(make_voice(0.01 + 0.02 * v));
+    }
+
+    // Parallel mixing matches sequential mixing exactly
+    Dynamo::Sound::OfflineOutput output = {2, 48000};
+    Dynamo::Sound::Buffer sequential = render_voices(output, voices, {4000});
+    Dynamo::Sound::Buffer parallel = render_voices(output, voices, {4000}, 3);
+    for (unsigned c = 0; c < 2; c++) {
+        for (unsigned i = 0; i < 4000; i++) {
+            REQUIRE(parallel[c][i] == sequential[c][i]);
+        }
+    }
+}
+
+TEST_CASE("Jukebox offline benchmarks", "[Jukebox]") {
+    std::vector<Dynamo::Sound::Buffer> voices;
+    for (unsigned v = 0; v < 32; v++) {
+        voices.emplace_back(make_voice(0.01 + 0.02 * v));
+    }
+
+    Dynamo::Sound::Buffer mix;
+    for (double rate : {44100.0, 48000.0}) {
+        Dynamo::Sound::Jukebox jukebox({2, rate});
+        std::vector<std::unique_ptr<Dynamo::Sound::Source>> sources;
+        for (const Dynamo::Sound::Buffer &voice : voices) {
+            sources.emplace_back(std::make_unique<Dynamo::Sound::Source>(voice));
+        }
+
+        BENCHMARK("Jukebox offline render 32 voices " + std::to_string(static_cast<unsigned>(rate)) + " Hz") {
+            // Loop the voices
+            for (std::unique_ptr<Dynamo::Sound::Source> &source : sources) {
+                if (!source->is_playing()) {
+                    source->seek(Dynamo::Seconds(0));
+                    jukebox.play(*source);
+                }
+            }
+            jukebox.render(mix, Dynamo::Sound::MAX_CHUNK_LENGTH);
+            return mix[0][1];
+        };
+    }
+}
+
+TEST_CASE("Jukebox offline stats", "[Jukebox]") {
+    Dynamo::Sound::Buffer voice = make_voice(0.05);
+    Dynamo::Sound::Jukebox jukebox({2, 48000});
+    Dynamo::Sound::JukeboxStats stats = jukebox.stats();
+    REQUIRE(stats.mix_time.count() == 0);
+    REQUIRE(stats.mix_time_mean.count() == 0);
+
+    // Renders are timed like updates
+    Dynamo::Sound::Source source(voice);
+    jukebox.play(source);
+    Dynamo::Sound::Buffer mix;
+    jukebox.render(mix, 1000);
+    jukebox.render(mix, 4000);
+    stats = jukebox.stats();
+    REQUIRE(stats.mix_time.count() > 0);
+    REQUIRE(stats.mix_time_max.count() >= stats.mix_time_mean.count());
+    REQUIRE(stats.output_overruns == 0);
+
+    // No device callbacks run offline
+    REQUIRE(stats.output_callbacks == 0);
+    REQUIRE(stats.output_underruns == 0);
+    REQUIRE(stats.input_callbacks == 0);
+    REQUIRE(stats.callback_interval.count() == 0);
+    for (unsigned long long count : stats.fill_histogram) {
+        REQUIRE(count == 0);
+    }
+}
+
+TEST_CASE("Jukebox offline stats polling", "[Jukebox]") {
+    Dynamo::Sound::Buffer voice = make_voice(0.05);
+    Dynamo::Sound::Jukebox jukebox({2, 48000});
+    Dynamo::Sound::Source source(voice);
+    jukebox.play(source);
+
+    // Poll the stats while another thread renders
+    std::atomic<bool> done = false;
+    std::thread renderer([&]() {
+        Dynamo::Sound::Buffer mix;
+        for (unsigned i = 0; i < 200; i++) {
+            jukebox.render(mix, 256);
+        }
+        done = true;
+    });
+    while (!done) {
+        Dynamo::Sound::JukeboxStats stats = jukebox.stats();
+        REQUIRE(stats.mix_time_mean.count() >= 0);
+        REQUIRE(stats.mix_time_max.count() >= stats.mix_time.count());
+    }
+    renderer.join();
+
+    Dynamo::Sound::JukeboxStats stats = jukebox.stats();
+    REQUIRE(stats.mix_time_max.count() >= stats.mix_time_mean.count());
+}
+
+TEST_CASE("Jukebox composite resampling toggle", "[Jukebox]") {
+    Dynamo::Sound::Buffer voice = make_voice(0.05);
+    Dynamo::Sound::Jukebox jukebox({2, 48000});
+    Dynamo::Sound::Source source(voice);
+
+    // Toggle the setting while another thread renders
+    std::atomic<bool> done = false;
+    std::thread renderer([&]() {
+        Dynamo::Sound::Buffer mix;
+        for (unsigned i = 0; i < 200; i++) {
+            if (!source.is_playing()) {
+                source.seek(Dynamo::Seconds(0));
+                jukebox.play(source);
+            }
+            jukebox.render(mix, 256);
+        }
+        done = true;
+    });
+    bool enabled = false;
+    while (!done) {
+        enabled = !enabled;
+        jukebox.set_composite_resampling(enabled);
+        std::this_thread::yield();
+    }
+    renderer.join();
+    REQUIRE(jukebox.get_composite_resampling() == enabled);
+}
\ No newline at end of file
@@ -0,0 +1,237 @@
+#include <Dynamo.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "../Common.hpp"
+
+static constexpr double OUTPUT_RATE = 48000;
+static constexpr unsigned CLIP_FRAMES = 1 << 14;
+static constexpr unsigned MAX_VOICES = 4096;
+
+/**
+ * @brief Filters of a single voice, so stateful filters are not shared.
+ *
+ */
+struct VoiceFilters {
+    Dynamo::Sound::Amplify amplify;
+    Dynamo::Sound::Distance distance;
+    Dynamo::Sound::Stereo stereo;
+    Dynamo::Sound::Binaural binaural;
+    Dynamo::Sound::FilterSequence sequence;
+
+    VoiceFilters() {
+        amplify.gain = 0.5;
+        sequence.push(distance);
+        sequence.push(binaural);
+    }
+
+    /**
+     * @brief Get a filter by name, or none for an unfiltered voice.
+     *
+     * @param name
+     * @return std::optional<Dynamo::Sound::FilterRef>
+     */
+    std::optional<Dynamo::Sound::FilterRef> get(const std::string &name) {
+        if (name == "Amplify") return amplify;
+        if (name == "Distance") return distance;
+        if (name == "Stereo") return stereo;
+        if (name == "Binaural") return binaural;
+        if (name == "FilterSequence") return sequence;
+        return {};
+    }
+};
+
+/**
+ * @brief Names of the filters applied to each voice.
+ *
+ */
+static const std::vector<std::string> FILTER_NAMES = {
+    "None",
+    "Amplify",
+    "Distance",
+    "Stereo",
+    "Binaural",
+    "FilterSequence",
+};
+
+/**
+ * @brief Generate a deterministic mono clip.
+ *
+ * @param frames
+ * @return Dynamo::Sound::Buffer
+ */
+Dynamo::Sound::Buffer make_clip(unsigned frames) {
+    Dynamo::Sound::Buffer clip(frames, 1);
+    for (unsigned i = 0; i < frames; i++) {
+        clip[0][i] = 0.01 * std::sin(0.07 * i) + 0.005 * std::sin(0.43 * i);
+    }
+    return clip;
+}
+
+/**
+ * @brief Looping voices mixed by an offline Jukebox.
+ *
+ */
+class VoiceMix {
+    Dynamo::Sound::Jukebox _jukebox;
+    std::vector<std::unique_ptr<VoiceFilters>> _filters;
+    std::vector<std::unique_ptr<Dynamo::Sound::Source>> _sources;
+    Dynamo::Sound::Buffer _chunk;
+
+  public:
+    VoiceMix(const Dynamo::Sound::Buffer &clip, unsigned voices, const std::string &filter) :
+        _jukebox({2, OUTPUT_RATE}) {
+        for (unsigned v = 0; v < voices; v++) {
+            _filters.emplace_back(std::make_unique<VoiceFilters>());
+            _sources.emplace_back(std::make_unique<Dynamo::Sound::Source>(clip, _filters.back()->get(filter)));
+
+            // Spread the voices around the listener
+            float angle = 2.399 * v;
+            _sources.back()->position = Dynamo::Vec3(std::cos(angle), 0.3, std::sin(angle)) * (2 + v % 7);
+        }
+    }
+
+    /**
+     * @brief Mix the next chunk, restarting finished voices.
+     *
+     * @return const Dynamo::Sound::Buffer&
+     */
+    const Dynamo::Sound::Buffer &mix_chunk() {
+        for (std::unique_ptr<Dynamo::Sound::Source> &source : _sources) {
+            if (!source->is_playing()) {
+                source->seek(Dynamo::Seconds(0));
+                _jukebox.play(*source);
+            }
+        }
+        _jukebox.render(_chunk, Dynamo::Sound::MAX_CHUNK_LENGTH);
+        return _chunk;
+    }
+};
+
+/**
+ * @brief Measure the mean time to mix a chunk of voices.
+ *
+ * @param clip
+ * @param voices
+ * @param filter
+ * @return double Seconds per chunk.
+ */
+double measure_chunk_time(const Dynamo::Sound::Buffer &clip, unsigned voices, const std::string &filter) {
+    VoiceMix mix(clip, voices, filter);
+    mix.mix_chunk();
+
+    unsigned chunks = 16;
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned i = 0; i < chunks; i++) {
+        mix.mix_chunk();
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / chunks;
+}
+
+TEST_CASE("Mixer filter benchmarks", "[Mixer]") {
+    Dynamo::Sound::Buffer clip = make_clip(CLIP_FRAMES);
+    Dynamo::Sound::Buffer chunk(Dynamo::Sound::MAX_CHUNK_LENGTH, 1);
+    Dynamo::Sound::Listener listener;
+    Dynamo::Sound::Source source(clip);
+    source.position = Dynamo::Vec3(3, 1, -2);
+
+    // Each filter processes a single chunk in-place, as in the mixer
+    for (const std::string &name : FILTER_NAMES) {
+        VoiceFilters filters;
+        std::optional<Dynamo::Sound::FilterRef> filter = filters.get(name);
+        if (!filter.has_value()) continue;
+
+        BENCHMARK("Mixer " + name + " chunk benchmark") {
+            chunk.resize(Dynamo::Sound::MAX_CHUNK_LENGTH, 1);
+            std::copy(clip[0], clip[0] + Dynamo::Sound::MAX_CHUNK_LENGTH, chunk[0]);
+            filter.value().get().apply(chunk, chunk, source, listener);
+            return chunk[0][1];
+        };
+    }
+}
+
+TEST_CASE("Mixer DSP benchmarks", "[Mixer]") {
+    Dynamo::Sound::Buffer clip = make_clip(CLIP_FRAMES);
+    Dynamo::Sound::Buffer chunk(Dynamo::Sound::MAX_CHUNK_LENGTH, 1);
+
+    // Direct evaluation of the windowed sinc, for comparison with the tables
+    BENCHMARK("Mixer resample_signal chunk benchmark") {
+        Dynamo::Sound::resample_signal(clip[0],
+                                       chunk[0],
+                                       0.25,
+                                       Dynamo::Sound::MAX_CHUNK_LENGTH * 44100 / OUTPUT_RATE,
+                                       44100,
+                                       OUTPUT_RATE);
+        return chunk[0][1];
+    };
+
+    const Dynamo::Sound::Resampler &resampler = Dynamo::Sound::Resampler::get(44100, OUTPUT_RATE);
+    BENCHMARK("Mixer resample chunk benchmark") {
+        resampler.resample(clip[0], chunk[0], 0.25, Dynamo::Sound::MAX_CHUNK_LENGTH * 44100 / OUTPUT_RATE);
+        return chunk[0][1];
+    };
+
+    Dynamo::Sound::StreamResampler stream;
+    stream.reset(resampler, 1);
+    unsigned offset = 0;
+    BENCHMARK("Mixer stream resample chunk benchmark") {
+        unsigned required = stream.required(Dynamo::Sound::MAX_CHUNK_LENGTH);
+        offset = offset + required < CLIP_FRAMES ? offset : 0;
+        stream.write(clip, offset, required);
+        stream.read(chunk, Dynamo::Sound::MAX_CHUNK_LENGTH);
+        offset += required;
+        return chunk[0][1];
+    };
+
+    for (unsigned channels : {2, 6}) {
+        Dynamo::Sound::Buffer remixed(Dynamo::Sound::MAX_CHUNK_LENGTH, channels);
+        BENCHMARK("Mixer remix 1 - " + std::to_string(channels) + " chunk benchmark") {
+            remixed.silence();
+            chunk.remix(remixed);
+            return remixed[0][1];
+        };
+    }
+}
+
+TEST_CASE("Mixer voice benchmarks", "[Mixer]") {
+    Dynamo::Sound::Buffer clip = make_clip(CLIP_FRAMES);
+    for (const std::string name : {"None", "Distance", "Binaural"}) {
+        for (unsigned voices : {1, 16, 64}) {
+            VoiceMix mix(clip, voices, name);
+            BENCHMARK("Mixer " + std::to_string(voices) + " voices " + name + " chunk benchmark") {
+                return mix.mix_chunk()[0][1];
+            };
+        }
+    }
+}
+
+TEST_CASE("Mixer voices per deadline", "[Mixer][.benchmark]") {
+    Dynamo::Sound::Buffer clip = make_clip(CLIP_FRAMES);
+    double deadline = Dynamo::Sound::MAX_CHUNK_LENGTH / OUTPUT_RATE;
+    for (const std::string &name : FILTER_NAMES) {
+        // Double the voices until a chunk misses the deadline, then bisect
+        unsigned lo = 0;
+        unsigned hi = 1;
+        while (hi <= MAX_VOICES && measure_chunk_time(clip, hi, name) <= deadline) {
+            lo = hi;
+            hi *= 2;
+        }
+        while (hi <= MAX_VOICES && hi - lo > std::max(1u, lo / 16)) {
+            unsigned mid = (lo + hi) / 2;
+            if (measure_chunk_time(clip, mid, name) <= deadline) {
+                lo = mid;
+            } else {
+                hi = mid;
+            }
+        }
+
+        std::string voices = hi > MAX_VOICES ? "at least " + std::to_string(lo) : std::to_string(lo);
+        Dynamo::Log::info("Mixer {} fits {} voices in a {:.2f} ms chunk", name, voices, deadline * 1e3);
+
+        // An unfiltered voice must always mix in real time
+        if (name == "None") {
+            REQUIRE(lo >= 1);
+        }
+    }
+}
\ No newline at end of file
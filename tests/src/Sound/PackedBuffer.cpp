@@ -0,0 +1,87 @@
+#include <Dynamo.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "../Common.hpp"
+
+static constexpr unsigned CLIP_LENGTH = 10000;
+
+/**
+ * @brief Generate a deterministic stereo clip.
+ *
+ * @return Dynamo::Sound::Buffer
+ */
+Dynamo::Sound::Buffer make_clip() {
+    Dynamo::Sound::Buffer clip(CLIP_LENGTH, 2);
+    for (unsigned i = 0; i < CLIP_LENGTH; i++) {
+        clip[0][i] = 0.5 * std::sin(0.03 * i) + 0.2 * std::sin(0.37 * i + 1);
+        clip[1][i] = 0.6 * std::sin(0.011 * i + 2) * std::cos(0.002 * i);
+    }
+    return clip;
+}
+
+TEST_CASE("PackedBuffer int16", "[PackedBuffer]") {
+    Dynamo::Sound::Buffer clip = make_clip();
+    Dynamo::Sound::PackedBuffer packed(clip, Dynamo::Sound::SampleFormat::Int16);
+    REQUIRE(packed.frames() == CLIP_LENGTH);
+    REQUIRE(packed.channels() == 2);
+    REQUIRE(packed.size() * 2 == CLIP_LENGTH * 2 * sizeof(Dynamo::Sound::WaveSample));
+
+    Dynamo::Sound::Buffer decoded(CLIP_LENGTH, 2);
+    packed.decode(decoded, 0, CLIP_LENGTH);
+    for (unsigned c = 0; c < 2; c++) {
+        for (unsigned i = 0; i < CLIP_LENGTH; i++) {
+            REQUIRE_THAT(decoded[c][i], Approx(clip[c][i], 1.0 / 32767));
+        }
+    }
+}
+
+TEST_CASE("PackedBuffer ADPCM", "[PackedBuffer]") {
+    Dynamo::Sound::Buffer clip = make_clip();
+    Dynamo::Sound::PackedBuffer packed(clip, Dynamo::Sound::SampleFormat::ADPCM);
+    REQUIRE(packed.frames() == CLIP_LENGTH);
+    REQUIRE(packed.channels() == 2);
+    REQUIRE(packed.size() * 7 < CLIP_LENGTH * 2 * sizeof(Dynamo::Sound::WaveSample));
+
+    Dynamo::Sound::Buffer decoded(CLIP_LENGTH, 2);
+    packed.decode(decoded, 0, CLIP_LENGTH);
+    for (unsigned c = 0; c < 2; c++) {
+        double power = 0;
+        double noise = 0;
+        for (unsigned i = 0; i < CLIP_LENGTH; i++) {
+            double error = clip[c][i] - decoded[c][i];
+            power += clip[c][i] * clip[c][i];
+            noise += error * error;
+        }
+        REQUIRE(10 * std::log10(power / noise) > 30);
+    }
+
+    // Decoding from any frame matches decoding the whole clip
+    Dynamo::Sound::Buffer chunk(300, 2);
+    for (unsigned offset : {0, 1, 63, 64, 100, 9700}) {
+        unsigned length = std::min(300U, CLIP_LENGTH - offset);
+        packed.decode(chunk, offset, length);
+        for (unsigned c = 0; c < 2; c++) {
+            for (unsigned i = 0; i < length; i++) {
+                REQUIRE(chunk[c][i] == decoded[c][offset + i]);
+            }
+        }
+    }
+}
+
+TEST_CASE("PackedBuffer benchmarks", "[PackedBuffer]") {
+    Dynamo::Sound::Buffer clip = make_clip();
+    Dynamo::Sound::Buffer chunk(Dynamo::Sound::MAX_CHUNK_LENGTH, 2);
+    for (Dynamo::Sound::SampleFormat format :
+         {Dynamo::Sound::SampleFormat::Int16, Dynamo::Sound::SampleFormat::ADPCM}) {
+        Dynamo::Sound::PackedBuffer packed(clip, format);
+        std::string name = format == Dynamo::Sound::SampleFormat::Int16 ? "int16" : "ADPCM";
+
+        unsigned offset = 0;
+        BENCHMARK("PackedBuffer " + name + " chunk decode benchmark") {
+            offset = (offset + 97) % (CLIP_LENGTH - Dynamo::Sound::MAX_CHUNK_LENGTH);
+            packed.decode(chunk, offset, Dynamo::Sound::MAX_CHUNK_LENGTH);
+            return chunk[0][1];
+        };
+    }
+}
\ No newline at end of file
@@ -0,0 +1,227 @@
+#include <Dynamo.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "../Common.hpp"
+
+static constexpr unsigned SIGNAL_LENGTH = 4096;
+
+/**
+ * @brief Generate a deterministic band-limited test signal.
+ *
+ * @param length
+ * @return std::vector<Dynamo::Sound::WaveSample>
+ */
+std::vector<Dynamo::Sound::WaveSample> make_tones(unsigned length) {
+    std::vector<Dynamo::Sound::WaveSample> signal(length);
+    for (unsigned i = 0; i < length; i++) {
+        signal[i] = 0.5 * std::sin(0.05 * i) + 0.3 * std::sin(0.71 * i + 1) + 0.2 * std::sin(2.3 * i + 2);
+    }
+    return signal;
+}
+
+/**
+ * @brief Compute the signal-to-noise ratio of a signal against a reference.
+ *
+ * @param reference
+ * @param signal
+ * @param length
+ * @return double
+ */
+double compute_snr(const Dynamo::Sound::WaveSample *reference,
+                   const Dynamo::Sound::WaveSample *signal,
+                   unsigned length) {
+    double power = 0;
+    double noise = 0;
+    for (unsigned i = 0; i < length; i++) {
+        double error = reference[i] - signal[i];
+        power += reference[i] * reference[i];
+        noise += error * error;
+    }
+    return noise == 0 ? INFINITY : 10 * std::log10(power / noise);
+}
+
+TEST_CASE("Resampler quality", "[Resample]") {
+    std::vector<Dynamo::Sound::WaveSample> src = make_tones(SIGNAL_LENGTH);
+    std::vector<std::array<double, 2>> rates = {
+        {44100, 48000},
+        {48000, 44100},
+        {22050, 44100},
+        {88200, 44100},
+        {44100, 44117},
+        {44100.5, 48000},
+    };
+    for (const std::array<double, 2> &rate : rates) {
+        const Dynamo::Sound::Resampler &resampler = Dynamo::Sound::Resampler::get(rate[0], rate[1]);
+        unsigned length = SIGNAL_LENGTH * rate[1] / rate[0];
+
+        // When downsampling, the filter is discontinuous across source frames,
+        // so offset the start slightly to keep the accumulated time in
+        // resample_signal() from rounding below whole source frames
+        double offset = 1e-6;
+
+        std::vector<Dynamo::Sound::WaveSample> expected(length, 0);
+        Dynamo::Sound::resample_signal(src.data(), expected.data(), offset, SIGNAL_LENGTH - offset, rate[0], rate[1]);
+
+        std::vector<Dynamo::Sound::WaveSample> dst(length, 0);
+        resampler.resample(src.data(), dst.data(), offset, SIGNAL_LENGTH - offset);
+        REQUIRE(compute_snr(expected.data(), dst.data(), length) > 90);
+    }
+
+    // Common ratios use precomputed phase tables
+    REQUIRE(Dynamo::Sound::Resampler::get(44100, 48000).phases() == 160);
+    REQUIRE(Dynamo::Sound::Resampler::get(48000, 44100).phases() == 147);
+    REQUIRE(Dynamo::Sound::Resampler::get(22050, 44100).phases() == 2);
+    REQUIRE(Dynamo::Sound::Resampler::get(88200, 44100).phases() == 1);
+    REQUIRE(Dynamo::Sound::Resampler::get(44100, 44117).phases() == 0);
+    REQUIRE(Dynamo::Sound::Resampler::get(44100.5, 48000).phases() == 0);
+}
+
+TEST_CASE("Resampler chunk quality", "[Resample]") {
+    // Resample chunks of a longer signal as the mixer does
+    std::vector<Dynamo::Sound::WaveSample> src = make_tones(SIGNAL_LENGTH);
+    for (double dst_rate : {48000.0, 44117.0}) {
+        const Dynamo::Sound::Resampler &resampler = Dynamo::Sound::Resampler::get(44100, dst_rate);
+        double length = Dynamo::Sound::MAX_CHUNK_LENGTH * 44100 / dst_rate;
+        std::vector<Dynamo::Sound::WaveSample> expected(Dynamo::Sound::MAX_CHUNK_LENGTH);
+        std::vector<Dynamo::Sound::WaveSample> dst(Dynamo::Sound::MAX_CHUNK_LENGTH);
+        for (double frame = 0; frame + length < SIGNAL_LENGTH; frame += length) {
+            Dynamo::Sound::resample_signal(src.data(), expected.data(), frame, length, 44100, dst_rate);
+            resampler.resample(src.data(), dst.data(), frame, length);
+            REQUIRE(compute_snr(expected.data(), dst.data(), dst.size()) > 90);
+        }
+    }
+}
+
+TEST_CASE("Resampler benchmarks", "[Resample]") {
+    std::vector<Dynamo::Sound::WaveSample> src = make_tones(SIGNAL_LENGTH);
+    std::vector<Dynamo::Sound::WaveSample> dst(SIGNAL_LENGTH * 2);
+    std::vector<std::array<double, 2>> rates = {
+        {44100, 48000},
+        {48000, 44100},
+        {22050, 44100},
+        {88200, 44100},
+        {44100, 44117},
+    };
+    for (const std::array<double, 2> &rate : rates) {
+        const Dynamo::Sound::Resampler &resampler = Dynamo::Sound::Resampler::get(rate[0], rate[1]);
+        std::string name = std::to_string(static_cast<unsigned>(rate[0])) + " to " +
+                           std::to_string(static_cast<unsigned>(rate[1]));
+
+        BENCHMARK("Resample signal " + name + " benchmark") {
+            Dynamo::Sound::resample_signal(src.data(), dst.data(), 0, SIGNAL_LENGTH, rate[0], rate[1]);
+            return dst[1];
+        };
+
+        BENCHMARK("Polyphase resampler " + name + " benchmark") {
+            resampler.resample(src.data(), dst.data(), 0, SIGNAL_LENGTH);
+            return dst[1];
+        };
+    }
+}
+
+/**
+ * @brief Resample a signal in chunks of varying lengths with a stream.
+ *
+ * @param stream
+ * @param src
+ * @param dst
+ * @param frames Number of output frames.
+ */
+void stream_signal(Dynamo::Sound::StreamResampler &stream,
+                   const Dynamo::Sound::Buffer &src,
+                   Dynamo::Sound::Buffer &dst,
+                   unsigned frames) {
+    Dynamo::Sound::Buffer chunk(Dynamo::Sound::MAX_CHUNK_LENGTH, src.channels());
+    std::array<unsigned, 6> lengths = {1, 7, 256, 100, 33, 255};
+    unsigned offset = 0;
+    for (unsigned i = 0; offset < frames; i++) {
+        unsigned length = std::min(lengths[i % lengths.size()], frames - offset);
+
+        // Write the required source frames, silent outside of the signal
+        unsigned required = stream.required(length);
+        for (unsigned j = 0; j < required; j++) {
+            long long frame = stream.next_frame();
+            if (frame >= 0 && frame < src.frames()) {
+                stream.write(src, frame, 1);
+            } else {
+                stream.write_silence(1);
+            }
+        }
+        REQUIRE(stream.required(length) == 0);
+
+        // Reading up to the available frames needs no more source frames
+        unsigned available = stream.available();
+        REQUIRE(available >= length);
+        REQUIRE(stream.required(available) == 0);
+        REQUIRE(stream.required(available + 1) > 0);
+
+        stream.read(chunk, length);
+        for (unsigned c = 0; c < src.channels(); c++) {
+            std::copy(chunk[c], chunk[c] + length, dst[c] + offset);
+        }
+        offset += length;
+    }
+}
+
+TEST_CASE("Stream resampler", "[Resample]") {
+    std::vector<Dynamo::Sound::WaveSample> tones = make_tones(SIGNAL_LENGTH);
+    Dynamo::Sound::Buffer src(SIGNAL_LENGTH, 2);
+    for (unsigned i = 0; i < SIGNAL_LENGTH; i++) {
+        src[0][i] = tones[i];
+        src[1][i] = tones[SIGNAL_LENGTH - 1 - i];
+    }
+
+    std::vector<std::array<double, 2>> rates = {
+        {44100, 48000},
+        {48000, 44100},
+        {22050, 44100},
+        {88200, 44100},
+        {44100, 44117},
+    };
+    for (const std::array<double, 2> &rate : rates) {
+        const Dynamo::Sound::Resampler &resampler = Dynamo::Sound::Resampler::get(rate[0], rate[1]);
+        for (double start : {0.0, 5 * rate[0] / rate[1], 1000.25}) {
+            unsigned frames = (SIGNAL_LENGTH - start) * rate[1] / rate[0];
+
+            // Output is identical to resampling the whole signal
+            Dynamo::Sound::Buffer expected(frames, 2);
+            for (unsigned c = 0; c < 2; c++) {
+                resampler.resample(src[c], expected[c], start, SIGNAL_LENGTH - start);
+            }
+
+            Dynamo::Sound::StreamResampler stream;
+            stream.reset(resampler, 2, start);
+            Dynamo::Sound::Buffer dst(frames, 2);
+            stream_signal(stream, src, dst, frames);
+            for (unsigned c = 0; c < 2; c++) {
+                for (unsigned i = 0; i < frames; i++) {
+                    REQUIRE(dst[c][i] == expected[c][i]);
+                }
+            }
+            REQUIRE_THAT(stream.time(), Approx(start + frames * rate[0] / rate[1], 1e-6));
+        }
+    }
+}
+
+TEST_CASE("Stream resampler benchmarks", "[Resample]") {
+    std::vector<Dynamo::Sound::WaveSample> tones = make_tones(SIGNAL_LENGTH);
+    Dynamo::Sound::Buffer src(SIGNAL_LENGTH, 2);
+    for (unsigned c = 0; c < 2; c++) {
+        std::copy(tones.begin(), tones.end(), src[c]);
+    }
+
+    const Dynamo::Sound::Resampler &resampler = Dynamo::Sound::Resampler::get(44100, 48000);
+    Dynamo::Sound::StreamResampler stream;
+    Dynamo::Sound::Buffer chunk(Dynamo::Sound::MAX_CHUNK_LENGTH, 2);
+
+    BENCHMARK("Stream resampler 44100 to 48000 chunk benchmark") {
+        if (stream.resampler() == nullptr || stream.next_frame() + SIGNAL_LENGTH / 2 > SIGNAL_LENGTH) {
+            stream.reset(resampler, 2);
+            stream.write_silence(-stream.next_frame());
+        }
+        stream.write(src, stream.next_frame(), stream.required(Dynamo::Sound::MAX_CHUNK_LENGTH));
+        stream.read(chunk, Dynamo::Sound::MAX_CHUNK_LENGTH);
+        return chunk[0][1];
+    };
+}
\ No newline at end of file
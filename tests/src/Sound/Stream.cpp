@@ -0,0 +1,135 @@
+#include <Dynamo.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "../Common.hpp"
+
+static constexpr unsigned SOUND_LENGTH = 40000;
+
+/**
+ * @brief Decodes a sound held in memory.
+ *
+ */
+class MemoryDecoder : public Dynamo::Sound::StreamDecoder {
+    Dynamo::Sound::Buffer _sound;
+    double _sample_rate;
+    unsigned _position;
+
+  public:
+    MemoryDecoder(const Dynamo::Sound::Buffer &sound, double sample_rate) :
+        _sound(sound), _sample_rate(sample_rate), _position(0) {}
+
+    unsigned channels() const override { return _sound.channels(); }
+
+    double sample_rate() const override { return _sample_rate; }
+
+    unsigned frames() const override { return _sound.frames(); }
+
+    void seek(unsigned frame) override { _position = std::min(frame, _sound.frames()); }
+
+    unsigned read(Dynamo::Sound::Buffer &dst) override {
+        const Dynamo::Sound::Buffer &sound = _sound;
+        unsigned length = std::min(dst.frames(), sound.frames() - _position);
+        for (unsigned c = 0; c < sound.channels(); c++) {
+            std::copy(sound[c] + _position, sound[c] + _position + length, dst[c]);
+        }
+        _position += length;
+        return length;
+    }
+};
+
+/**
+ * @brief Generate a deterministic stereo sound.
+ *
+ * @return Dynamo::Sound::Buffer
+ */
+Dynamo::Sound::Buffer make_sound() {
+    Dynamo::Sound::Buffer sound(SOUND_LENGTH, 2);
+    for (unsigned i = 0; i < SOUND_LENGTH; i++) {
+        sound[0][i] = 0.5 * std::sin(0.02 * i) + 0.3 * std::sin(0.9 * i);
+        sound[1][i] = 0.4 * std::sin(0.13 * i + 1);
+    }
+    return sound;
+}
+
+/**
+ * @brief Read a chunk from a stream, waiting for the read-ahead thread.
+ *
+ * @param stream
+ * @param dst
+ * @param offset   First frame to read.
+ * @param buffered Number of frames to wait for.
+ */
+void read_stream(Dynamo::Sound::Stream &stream, Dynamo::Sound::Buffer &dst, unsigned offset, unsigned buffered) {
+    while (stream.buffered() < buffered) {
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+    stream.read(dst, offset, dst.frames());
+}
+
+TEST_CASE("Stream", "[Stream]") {
+    Dynamo::Sound::Buffer sound = make_sound();
+    for (double rate : {44100.0, 48000.0, 22050.0}) {
+        Dynamo::Sound::Stream stream(std::make_unique<MemoryDecoder>(sound, rate));
+        REQUIRE(stream.channels() == 2);
+        REQUIRE(stream.frames() == static_cast<unsigned>(SOUND_LENGTH * (44100 / rate)));
+
+        // Output is identical to resampling the whole sound
+        Dynamo::Sound::Buffer expected(stream.frames(), 2);
+        const Dynamo::Sound::Resampler &resampler = Dynamo::Sound::Resampler::get(rate, 44100);
+        for (unsigned c = 0; c < 2; c++) {
+            if (rate == 44100) {
+                std::copy(sound[c], sound[c] + SOUND_LENGTH, expected[c]);
+            } else {
+                resampler.resample(sound[c], expected[c], 0, SOUND_LENGTH);
+            }
+        }
+
+        Dynamo::Sound::Buffer chunk(Dynamo::Sound::MAX_CHUNK_LENGTH, 2);
+        for (unsigned offset = 0; offset < stream.frames(); offset += chunk.frames()) {
+            unsigned length = std::min(chunk.frames(), stream.frames() - offset);
+            read_stream(stream, chunk, offset, length);
+            for (unsigned c = 0; c < 2; c++) {
+                for (unsigned i = 0; i < length; i++) {
+                    REQUIRE(chunk[c][i] == expected[c][offset + i]);
+                }
+            }
+        }
+
+        // Seeking back restarts decoding
+        unsigned offset = 1000;
+        stream.read(chunk, offset, chunk.frames());
+        read_stream(stream, chunk, offset, chunk.frames());
+        for (unsigned c = 0; c < 2; c++) {
+            for (unsigned i = 0; i < chunk.frames(); i++) {
+                REQUIRE_THAT(chunk[c][i], Approx(expected[c][offset + i], 1e-6));
+            }
+        }
+
+        // Memory is bounded by the read-ahead ring
+        REQUIRE(stream.buffered() <= Dynamo::Sound::STREAM_BUFFER_FRAMES);
+    }
+}
+
+TEST_CASE("Stream underrun", "[Stream]") {
+    Dynamo::Sound::Buffer sound = make_sound();
+    Dynamo::Sound::Stream stream(std::make_unique<MemoryDecoder>(sound, 44100));
+    Dynamo::Sound::Buffer chunk(Dynamo::Sound::MAX_CHUNK_LENGTH, 2);
+    read_stream(stream, chunk, 0, Dynamo::Sound::STREAM_BUFFER_FRAMES);
+
+    // Reading past the decoded frames is silent
+    unsigned offset = Dynamo::Sound::STREAM_BUFFER_FRAMES + 500;
+    stream.read(chunk, offset, chunk.frames());
+    for (unsigned i = 0; i < chunk.frames(); i++) {
+        REQUIRE(chunk[0][i] == 0);
+    }
+
+    // The missed frames are skipped once they are decoded
+    offset += chunk.frames();
+    read_stream(stream, chunk, offset, Dynamo::Sound::STREAM_BUFFER_FRAMES);
+    for (unsigned c = 0; c < 2; c++) {
+        for (unsigned i = 0; i < chunk.frames(); i++) {
+            REQUIRE(chunk[c][i] == sound[c][offset + i]);
+        }
+    }
+}
\ No newline at end of file